@@ -20,6 +20,7 @@
 package org.a11y.brlapi;
 
 import java.io.InterruptedIOException;
+import java.nio.ByteBuffer;
 
 public class Connection extends ConnectionBase {
   public Connection (ConnectionSettings settings) throws ConnectException {
@@ -55,6 +56,13 @@ public class Connection extends ConnectionBase {
     return readKey(true);
   }
 
+  // Collect the keys that have already been received without waiting.
+  // Nothing is allocated, so it can be called each time an event loop
+  // (e.g. one that polls getFileDescriptor) finds the connection readable.
+  public final int readKeys (long[] codes) throws InterruptedIOException {
+    return readKeys(codes, 0);
+  }
+
   public void write (byte[] dots) {
     int count = getCellCount();
 
@@ -68,6 +76,13 @@ public class Connection extends ConnectionBase {
     writeDots(dots);
   }
 
+  // The dots are passed to the server straight from the direct buffer,
+  // from its current position up to its limit, without being copied.
+  // The position of the buffer isn't changed.
+  public void write (ByteBuffer dots) {
+    writeDirectDots(dots, dots.position(), dots.limit());
+  }
+
   public void write (int cursor, String text) {
     if (text != null) {
       int count = getCellCount();
@@ -20,11 +20,18 @@
 package org.a11y.brlapi;
 
 import java.util.Arrays;
+import java.nio.ByteBuffer;
 
 public class WriteArguments extends Component {
   private String text = null;
   private byte andMask[] = null;
   private byte orMask[] = null;
+  private ByteBuffer andBuffer = null;
+  private ByteBuffer orBuffer = null;
+  private int andBufferOffset = 0;
+  private int orBufferOffset = 0;
+  private int andBufferLimit = 0;
+  private int orBufferLimit = 0;
   private int regionBegin = 0;
   private int regionSize = 0;
   private int cursorPosition = Constants.CURSOR_LEAVE;
@@ -48,6 +55,22 @@ public class WriteArguments extends Component {
 
   public WriteArguments setAndMask (byte[] mask) {
     andMask = mask;
+    andBuffer = null;
+    return this;
+  }
+
+  public ByteBuffer getAndMaskBuffer () {
+    return andBuffer;
+  }
+
+  // The mask is passed to the server straight from the direct buffer,
+  // from its current position up to its limit, without being copied.
+  public WriteArguments setAndMaskBuffer (ByteBuffer mask) {
+    checkDirectBuffer(AND_MASK, mask);
+    andBuffer = mask;
+    andBufferOffset = (mask != null)? mask.position(): 0;
+    andBufferLimit = (mask != null)? mask.limit(): 0;
+    andMask = null;
     return this;
   }
 
@@ -57,6 +80,22 @@ public class WriteArguments extends Component {
 
   public WriteArguments setOrMask (byte[] mask) {
     orMask = mask;
+    orBuffer = null;
+    return this;
+  }
+
+  public ByteBuffer getOrMaskBuffer () {
+    return orBuffer;
+  }
+
+  // The mask is passed to the server straight from the direct buffer,
+  // from its current position up to its limit, without being copied.
+  public WriteArguments setOrMaskBuffer (ByteBuffer mask) {
+    checkDirectBuffer(OR_MASK, mask);
+    orBuffer = mask;
+    orBufferOffset = (mask != null)? mask.position(): 0;
+    orBufferLimit = (mask != null)? mask.limit(): 0;
+    orMask = null;
     return this;
   }
 
@@ -110,6 +149,25 @@ public class WriteArguments extends Component {
   public final static String CURSOR_POSITION = "cursor position";
   public final static String DISPLAY_NUMBER = "display number";
 
+  private static void checkDirectBuffer (String description, ByteBuffer buffer) {
+    if ((buffer != null) && !buffer.isDirect()) {
+      throw new IllegalArgumentException(
+        String.format(
+          "%s buffer is not direct", description
+        )
+      );
+    }
+  }
+
+  private static byte[] copyBuffer (ByteBuffer buffer, int offset, int limit) {
+    byte[] bytes = new byte[limit - offset];
+    ByteBuffer view = buffer.duplicate();
+    view.limit(limit);
+    view.position(offset);
+    view.get(bytes);
+    return bytes;
+  }
+
   private static void checkRange (String description, int value, Integer minimum, Integer maximum) {
     try {
       if (minimum != null) Parse.checkMinimum(description, value, minimum);
@@ -119,14 +177,24 @@ public class WriteArguments extends Component {
     }
   }
 
+  private int getAndSize () {
+    if (andBuffer != null) return andBufferLimit - andBufferOffset;
+    return andMask.length;
+  }
+
+  private int getOrSize () {
+    if (orBuffer != null) return orBufferLimit - orBufferOffset;
+    return orMask.length;
+  }
+
   public final void check (int cellCount, boolean fix) {
     boolean haveRegionBegin = regionBegin != 0;
     boolean haveRegionSize = regionSize != 0;
     boolean haveRegion = haveRegionBegin || haveRegionSize;
 
     boolean haveText = text != null;
-    boolean haveAndMask = andMask != null;
-    boolean haveOrMask = orMask != null;
+    boolean haveAndMask = (andMask != null) || (andBuffer != null);
+    boolean haveOrMask = (orMask != null) || (orBuffer != null);
     boolean haveContent = haveText || haveAndMask || haveOrMask;
 
     if (haveRegion || haveContent) {
@@ -163,8 +231,8 @@ public class WriteArguments extends Component {
 
         regionSize = 0;
         if (haveText) regionSize = Math.max(regionSize, text.length());
-        if (haveAndMask) regionSize = Math.max(regionSize, andMask.length);
-        if (haveOrMask) regionSize = Math.max(regionSize, orMask.length);
+        if (haveAndMask) regionSize = Math.max(regionSize, getAndSize());
+        if (haveOrMask) regionSize = Math.max(regionSize, getOrSize());
         haveRegion = haveRegionSize = true;
       }
 
@@ -214,9 +282,26 @@ public class WriteArguments extends Component {
       }
 
       if (haveAndMask) {
-        int andSize = andMask.length;
+        int andSize = getAndSize();
 
-        if (andSize > regionSize) {
+        if ((andBuffer != null) && (andSize < regionSize) && fix) {
+          // it needs to be padded so fall back to a copy of it
+          andMask = copyBuffer(andBuffer, andBufferOffset, andBufferLimit);
+          andBuffer = null;
+        }
+
+        if (andBuffer != null) {
+          // a larger buffer is fine since only the region is sent
+          if (andSize < regionSize) {
+            throw new IllegalStateException(
+              String.format(
+                "%s size is less than %s: %d < %d",
+                AND_MASK, REGION_SIZE,
+                andSize, regionSize
+              )
+            );
+          }
+        } else if (andSize > regionSize) {
           if (!fix) {
             throw new IllegalStateException(
               String.format(
@@ -243,15 +328,32 @@ public class WriteArguments extends Component {
 
           byte[] newMask = new byte[regionSize];
           System.arraycopy(andMask, 0, newMask, 0, andSize);
-          Arrays.fill(newMask, andSize, (regionSize - andSize), (byte)BYTE_MASK);
+          Arrays.fill(newMask, andSize, regionSize, (byte)BYTE_MASK);
           andMask = newMask;
         }
       }
 
       if (haveOrMask) {
-        int orSize = orMask.length;
+        int orSize = getOrSize();
 
-        if (orSize > regionSize) {
+        if ((orBuffer != null) && (orSize < regionSize) && fix) {
+          // it needs to be padded so fall back to a copy of it
+          orMask = copyBuffer(orBuffer, orBufferOffset, orBufferLimit);
+          orBuffer = null;
+        }
+
+        if (orBuffer != null) {
+          // a larger buffer is fine since only the region is sent
+          if (orSize < regionSize) {
+            throw new IllegalStateException(
+              String.format(
+                "%s size is less than %s: %d < %d",
+                OR_MASK, REGION_SIZE,
+                orSize, regionSize
+              )
+            );
+          }
+        } else if (orSize > regionSize) {
           if (!fix) {
             throw new IllegalStateException(
               String.format(
@@ -278,7 +380,7 @@ public class WriteArguments extends Component {
 
           byte[] newMask = new byte[regionSize];
           System.arraycopy(orMask, 0, newMask, 0, orSize);
-          Arrays.fill(newMask, orSize, (regionSize - orSize), (byte)0);
+          Arrays.fill(newMask, orSize, regionSize, (byte)0);
           orMask = newMask;
         }
       }
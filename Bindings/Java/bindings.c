@@ -678,6 +678,69 @@ JAVA_INSTANCE_METHOD(
   if (brlapi__setFocus(handle, tty) < 0) throwAPIError(env);
 }
 
+/* The bytes from offset to limit are the ones the caller may use - the
+ * capacity is only checked so that a bad limit can't overrun the buffer.
+ */
+static unsigned char *
+getDirectBytes (JNIEnv *env, jobject jBuffer, jint offset, jint limit, size_t size) {
+  if (!jBuffer) {
+    throwJavaError(env, JAVA_OBJ_NULL_POINTER_EXCEPTION, __func__);
+    return NULL;
+  }
+
+  unsigned char *address = (*env)->GetDirectBufferAddress(env, jBuffer);
+  if (!address) {
+    throwJavaError(env, JAVA_OBJ_ILLEGAL_ARGUMENT_EXCEPTION, "not a direct buffer");
+    return NULL;
+  }
+
+  jlong capacity = (*env)->GetDirectBufferCapacity(env, jBuffer);
+  if ((limit < 0) || (limit > capacity)) {
+    throwJavaError(env, JAVA_OBJ_ILLEGAL_ARGUMENT_EXCEPTION, "limit out of range");
+    return NULL;
+  }
+
+  if ((offset < 0) || (offset > limit) || ((limit - offset) < size)) {
+    throwJavaError(env, JAVA_OBJ_ILLEGAL_ARGUMENT_EXCEPTION, "buffer too small");
+    return NULL;
+  }
+
+  return address + offset;
+}
+
+static int
+getDirectMask (
+  JNIEnv *env, jclass class, jobject object,
+  const char *bufferName, const char *offsetName, const char *limitName,
+  size_t size, unsigned char **mask
+) {
+  jobject jBuffer;
+  jint offset;
+  jint limit;
+
+  {
+    FIND_FIELD(env, field, class, bufferName, JAVA_SIG_OBJECT(JAVA_OBJ_BYTE_BUFFER), 0);
+    jBuffer = JAVA_GET_FIELD(env, Object, object, field);
+  }
+
+  if (!jBuffer) {
+    *mask = NULL;
+    return 1;
+  }
+
+  {
+    FIND_FIELD(env, field, class, offsetName, JAVA_SIG_INT, 0);
+    offset = JAVA_GET_FIELD(env, Int, object, field);
+  }
+
+  {
+    FIND_FIELD(env, field, class, limitName, JAVA_SIG_INT, 0);
+    limit = JAVA_GET_FIELD(env, Int, object, field);
+  }
+
+  return !!(*mask = getDirectBytes(env, jBuffer, offset, limit, size));
+}
+
 JAVA_INSTANCE_METHOD(
   org_a11y_brlapi_ConnectionBase, writeText, void,
   jint cursor, jstring jText
@@ -720,6 +783,27 @@ JAVA_INSTANCE_METHOD(
   }
 }
 
+JAVA_INSTANCE_METHOD(
+  org_a11y_brlapi_ConnectionBase, writeDirectDots, void,
+  jobject jDots, jint offset, jint limit
+) {
+  GET_CONNECTION_HANDLE(env, this, );
+
+  unsigned int columns, rows;
+  if (brlapi__getDisplaySize(handle, &columns, &rows) < 0) {
+    throwAPIError(env);
+    return;
+  }
+
+  const unsigned char *cDots = getDirectBytes(env, jDots, offset, limit, columns*rows);
+  if (!cDots) return;
+
+  if (brlapi__writeDots(handle, cDots) < 0) {
+    throwAPIError(env);
+    return;
+  }
+}
+
 JAVA_INSTANCE_METHOD(
   org_a11y_brlapi_ConnectionBase, write, void,
   jobject jArguments
@@ -732,6 +816,11 @@ JAVA_INSTANCE_METHOD(
   GET_CONNECTION_HANDLE(env, this, );
   GET_CLASS(env, class, jArguments, );
   brlapi_writeArguments_t cArguments = BRLAPI_WRITEARGUMENTS_INITIALIZER;
+  int result = -1;
+
+  jstring jText = NULL;
+  jbyteArray jAndMask = NULL;
+  jbyteArray jOrMask = NULL;
 
   {
     FIND_FIELD(env, field, class, "displayNumber", JAVA_SIG_INT, );
@@ -748,7 +837,6 @@ JAVA_INSTANCE_METHOD(
     cArguments.regionSize = JAVA_GET_FIELD(env, Int, jArguments, field);
   }
 
-  jstring jText;
   {
     FIND_FIELD(env, field, class, "text", JAVA_SIG_STRING, );
 
@@ -760,25 +848,27 @@ JAVA_INSTANCE_METHOD(
     }
   }
 
-  jbyteArray jAndMask;
   {
     FIND_FIELD(env, field, class, "andMask", JAVA_SIG_ARRAY(JAVA_SIG_BYTE), );
 
     if ((jAndMask = JAVA_GET_FIELD(env, Object, jArguments, field))) {
       cArguments.andMask = (unsigned char *) (*env)->GetByteArrayElements(env, jAndMask, NULL);
-    } else {
-      cArguments.andMask = NULL;
+    } else if (!getDirectMask(env, class, jArguments,
+                              "andBuffer", "andBufferOffset", "andBufferLimit",
+                              cArguments.regionSize, &cArguments.andMask)) {
+      goto done;
     }
   }
 
-  jbyteArray jOrMask;
   {
     FIND_FIELD(env, field, class, "orMask", JAVA_SIG_ARRAY(JAVA_SIG_BYTE), );
 
     if ((jOrMask = JAVA_GET_FIELD(env, Object, jArguments, field))) {
       cArguments.orMask = (unsigned char *) (*env)->GetByteArrayElements(env, jOrMask, NULL);
-    } else {
-      cArguments.orMask = NULL;
+    } else if (!getDirectMask(env, class, jArguments,
+                              "orBuffer", "orBufferOffset", "orBufferLimit",
+                              cArguments.regionSize, &cArguments.orMask)) {
+      goto done;
     }
   }
 
@@ -787,12 +877,12 @@ JAVA_INSTANCE_METHOD(
     cArguments.cursor = JAVA_GET_FIELD(env, Int, jArguments, field);
   }
 
-  int result = brlapi__write(handle, &cArguments);
+  if ((result = brlapi__write(handle, &cArguments)) < 0) throwAPIError(env);
+
+done:
   if (jText) (*env)->ReleaseStringUTFChars(env, jText, cArguments.text); 
   if (jAndMask) (*env)->ReleaseByteArrayElements(env, jAndMask, (jbyte*) cArguments.andMask, JNI_ABORT); 
   if (jOrMask) (*env)->ReleaseByteArrayElements(env, jOrMask, (jbyte*) cArguments.orMask, JNI_ABORT); 
-
-  if (result < 0) throwAPIError(env);
 }
 
 JAVA_INSTANCE_METHOD(
@@ -810,6 +900,40 @@ JAVA_INSTANCE_METHOD(
   return newLong(env, code);
 }
 
+JAVA_INSTANCE_METHOD(
+  org_a11y_brlapi_ConnectionBase, readKeys, jint,
+  jlongArray jCodes, jint milliseconds
+) {
+  GET_CONNECTION_HANDLE(env, this, -1);
+
+  if (!jCodes) {
+    throwJavaError(env, JAVA_OBJ_NULL_POINTER_EXCEPTION, __func__);
+    return -1;
+  }
+
+  jsize size = (*env)->GetArrayLength(env, jCodes);
+  jsize count = 0;
+
+  while (count < size) {
+    brlapi_keyCode_t code;
+
+    // only wait for the first key - then just collect the ones already received
+    int result = brlapi__readKeyWithTimeout(handle, (count? 0: milliseconds), &code);
+
+    if (result < 0) {
+      if (!count) throwAPIError(env);
+      break;
+    }
+
+    if (!result) break;
+
+    jlong value = code;
+    (*env)->SetLongArrayRegion(env, jCodes, count++, 1, &value);
+  }
+
+  return count;
+}
+
 JAVA_INSTANCE_METHOD(
   org_a11y_brlapi_ConnectionBase, readKeyWithTimeout, jlong,
   jint milliseconds
@@ -0,0 +1,8 @@
+# Dependencies for brlapi_stubs.$O:
+brlapi_stubs.$O: $(SRC_DIR)/brlapi_stubs.c
+brlapi_stubs.$O: $(BLD_TOP)Programs/brlapi.h
+brlapi_stubs.$O: $(BLD_TOP)Programs/brlapi_constants.h
+brlapi_stubs.$O: $(SRC_TOP)Programs/brlapi_keycodes.h
+brlapi_stubs.$O: $(SRC_TOP)Programs/brlapi_param.h
+brlapi_stubs.$O: $(SRC_TOP)Programs/brlapi_protocol.h
+
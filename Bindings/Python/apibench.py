@@ -0,0 +1,86 @@
+###############################################################################
+# BRLTTY - A background process providing access to the console screen (when in
+#          text mode) for a blind person using a refreshable braille display.
+#
+# Copyright (C) 1995-2020 by The BRLTTY Developers.
+#
+# BRLTTY comes with ABSOLUTELY NO WARRANTY.
+#
+# This is free software, placed under the terms of the
+# GNU Lesser General Public License, as published by the Free Software
+# Foundation; either version 2.1 of the License, or (at your option) any
+# later version. Please see the file LICENSE-LGPL for details.
+#
+# Web Page: http://brltty.app/
+#
+# This software is maintained by Dave Mielke <dave@mielke.cc>.
+###############################################################################
+
+
+# Compare the per-call overhead of the copying and the zero-copy ways
+# of passing cells to the Python bindings.
+
+import sys
+import time
+import array
+import argparse
+
+from apitest import brlapi, logMessage
+
+def measure (name, function, count):
+  function()
+  start = time.perf_counter()
+
+  for i in range(count):
+    function()
+
+  elapsed = time.perf_counter() - start
+  sys.stdout.write("%-24s %8.2f usec/call\n" % (name, ((elapsed * 1e6) / count)))
+
+if __name__ == "__main__":
+  parser = argparse.ArgumentParser(description="Measure the per-call overhead of the BrlAPI Python bindings.")
+  parser.add_argument("-n", "--count", type=int, default=10000, help="the number of calls per measurement")
+  parser.add_argument("-H", "--host", default=None, help="the host (and port) of the BrlAPI server")
+  parser.add_argument("-A", "--auth", default=None, help="the authorization scheme")
+  parser.add_argument("-t", "--tty", type=int, default=brlapi.TTY_DEFAULT, help="the virtual terminal to write to")
+  options = parser.parse_args()
+
+  def encode (value):
+    if value is None: return None
+    return value.encode("utf-8")
+
+  brl = brlapi.Connection(encode(options.host), encode(options.auth))
+
+  try:
+    (columns, rows) = brl.displaySize
+    size = columns * rows
+
+    brl.enterTtyMode(options.tty)
+    try:
+      brl.ignoreAllKeys()
+
+      cells = bytes(bytearray((i % 0X100) for i in range(size)))
+      buffer = bytearray(cells)
+      view = memoryview(buffer)
+      cellArray = array.array("B", cells)
+      mask = cells.decode("latin1")
+
+      # bytes shorter than the display are padded, and hence copied
+      measure("writeDots(short bytes)", (lambda: brl.writeDots(cells[:-1])), options.count)
+      measure("writeDots(bytes)", (lambda: brl.writeDots(cells)), options.count)
+      measure("writeDots(memoryview)", (lambda: brl.writeDots(view)), options.count)
+      measure("writeDots(array)", (lambda: brl.writeDots(cellArray)), options.count)
+
+      # a str mask is encoded and then copied into the WriteStruct
+      measure("write(str mask)", (lambda: brl.write(regionBegin=1, regionSize=size, orMask=mask)), options.count)
+      measure("write(bytearray mask)", (lambda: brl.write(regionBegin=1, regionSize=size, orMask=buffer)), options.count)
+
+      # what the asyncio reader does each time the connection becomes readable
+      measure("pause(0)", (lambda: brl.pause(0)), options.count)
+    finally:
+      brl.leaveTtyMode()
+  except brlapi.OperationError as e:
+    logMessage("operation failed: %s" % (e, ))
+    sys.exit(1)
+  finally:
+    brl.closeConnection()
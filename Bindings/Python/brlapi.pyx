@@ -120,6 +120,7 @@ except brlapi.ConnectionError as e:
 cimport c_brlapi
 from libc.stdint cimport uint8_t, uint16_t, uint32_t, uint64_t, uintptr_t
 import errno
+import collections
 
 include "constants.auto.pyx"
 
@@ -613,8 +614,14 @@ cdef class Connection:
 			charset = None):
 		"""Update a specific region of the braille display and apply and/or masks.
 		See brlapi_write(3).
-		* s : gives information necessary for the update"""
+		* s : gives information necessary for the update
+
+		If text, andMask, or orMask is an object which supports the buffer protocol (bytes, bytearray, memoryview, array('B'), ...), it's passed to brlapi_write() without being copied. Such a buffer is only used for this call - it isn't stored into writeArguments."""
 		cdef int retval
+		cdef c_brlapi.brlapi_writeArguments_t c_args
+		cdef const unsigned char[::1] c_text = None
+		cdef const unsigned char[::1] c_andMask = None
+		cdef const unsigned char[::1] c_orMask = None
 		if not writeArguments:
 			writeArguments = WriteStruct()
 		if displayNumber != None:
@@ -624,17 +631,40 @@ cdef class Connection:
 		if regionSize != None:
 			writeArguments.regionSize = regionSize
 		if text:
-			writeArguments.text = text
+			if type(text) == unicode:
+				writeArguments.text = text
+			else:
+				c_text = text
 		if andMask:
-			writeArguments.attrAnd = andMask
+			if type(andMask) == unicode:
+				writeArguments.attrAnd = andMask
+			else:
+				c_andMask = andMask
 		if orMask:
-			writeArguments.attrOr = orMask
+			if type(orMask) == unicode:
+				writeArguments.attrOr = orMask
+			else:
+				c_orMask = orMask
 		if cursor != None:
 			writeArguments.cursor = cursor
 		if charset:
 			writeArguments.charset = charset
+
+		c_args = writeArguments.props
+		if c_text is not None:
+			c_args.text = <char*>&c_text[0]
+			c_args.textSize = c_text.shape[0]
+		if c_andMask is not None:
+			if c_andMask.shape[0] < c_args.regionSize:
+				raise ValueError("andMask is shorter than regionSize")
+			c_args.andMask = <unsigned char*>&c_andMask[0]
+		if c_orMask is not None:
+			if c_orMask.shape[0] < c_args.regionSize:
+				raise ValueError("orMask is shorter than regionSize")
+			c_args.orMask = <unsigned char*>&c_orMask[0]
+
 		with nogil:
-			retval = c_brlapi.brlapi__write(self.h, &writeArguments.props)
+			retval = c_brlapi.brlapi__write(self.h, &c_args)
 		if retval == -1:
 			raise OperationError()
 		else:
@@ -643,20 +673,21 @@ cdef class Connection:
 	def writeDots(self, dots):
 		"""Write the given dots array to the display.
 		See brlapi_writeDots(3).
-		* dots : points on an array of dot information, one per character. Its size must hence be the same as what displaysize provides."""
+		* dots : points on an array of dot information, one per character. Its size must hence be the same as what displaysize provides.
+
+		Any object which supports the buffer protocol (bytes, bytearray, memoryview, array('B'), ...) is accepted. If it's at least as large as the display, it's passed to brlapi_writeDots() without being copied."""
 		cdef int retval
-		cdef char *c_dots
-		cdef unsigned char *c_udots
+		cdef const unsigned char[::1] c_dots
 		(x, y) = self.displaySize
 		dispSize = x * y
 		if (type(dots) == unicode):
 			dots = dots.encode('latin1')
-		if (len(dots) < dispSize):
-			dots = dots + b"".center(dispSize - len(dots), b'\0')
 		c_dots = dots
-		c_udots = <unsigned char *>c_dots
+		if (c_dots.shape[0] < dispSize):
+			dots = bytes(c_dots) + b"".center(dispSize - c_dots.shape[0], b'\0')
+			c_dots = dots
 		with nogil:
-			retval = c_brlapi.brlapi__writeDots(self.h, c_udots)
+			retval = c_brlapi.brlapi__writeDots(self.h, &c_dots[0])
 		if retval == -1:
 			raise OperationError()
 		else:
@@ -731,6 +762,23 @@ cdef class Connection:
 			else:
 				return code
 
+	def pause(self, timeout_ms = -1):
+		"""Wait until an event is received from the BrlAPI server.
+		See brlapi_pause(3).
+
+		Pending parameter change notifications are processed (their callbacks are called) and pending key presses are queued for readKey(). Returns True if the wait was interrupted by a parameter change notification or by a signal, and False on timeout. A timeout_ms of 0 only processes what has already been received."""
+		cdef int retval
+		cdef int c_timeout_ms
+		c_timeout_ms = timeout_ms
+		with nogil:
+			retval = c_brlapi.brlapi__pause(self.h, c_timeout_ms)
+		if retval == -1:
+			if c_brlapi.brlapi_error.brlerrno == ERROR_LIBCERR and c_brlapi.brlapi_error.libcerrno == errno.EINTR:
+				return True
+			raise OperationError()
+		else:
+			return False
+
 	def expandKeyCode(self, code):
 		"""Expand a keycode into its individual components.
 		This is a stub to maintain backward compatibility.
@@ -1079,3 +1127,125 @@ cdef class Connection:
 
 		descr = entry
 		c_brlapi.brlapi_python_unwatchParameter(self.h, <c_brlapi.brlapi_python_paramCallbackDescriptor_t *>descr)
+
+class _AsyncChannel(object):
+	"""A queue of values delivered to futures of an asyncio event loop"""
+
+	def __init__(self, loop):
+		self.loop = loop
+		self.values = collections.deque()
+		self.waiters = collections.deque()
+		self.error = None
+
+	def put(self, value):
+		while self.waiters:
+			waiter = self.waiters.popleft()
+			if not waiter.done():
+				waiter.set_result(value)
+				return
+		self.values.append(value)
+
+	def fail(self, error):
+		self.error = error
+		while self.waiters:
+			waiter = self.waiters.popleft()
+			if not waiter.done():
+				waiter.set_exception(error)
+
+	def get(self):
+		future = self.loop.create_future()
+		if self.values:
+			future.set_result(self.values.popleft())
+		elif self.error:
+			future.set_exception(self.error)
+		else:
+			self.waiters.append(future)
+		return future
+
+class AsyncReader(object):
+	"""Read keys and parameter updates from an asyncio event loop.
+
+	Rather than blocking a thread within readKey(), the file descriptor of the connection is monitored by the event loop, and, whenever it becomes readable, all of the pending keys are read without waiting. Parameter change callbacks are called at that time too, from within the event loop thread.
+
+	Example :
+	  reader = brlapi.AsyncReader(b)
+	  reader.watchParameter(brlapi.PARAM_RENDERED_CELLS, 0, False)
+	  key = await reader.readKey()
+	  (param, subparam, flags, value) = await reader.readParameter()
+	  reader.close()
+
+	The connection must not be used for blocking reads (readKey(True), readKeyWithTimeout()) while the reader is active."""
+
+	def __init__(self, Connection connection, loop = None):
+		import asyncio
+		if loop is None:
+			loop = asyncio.get_event_loop()
+		self.connection = connection
+		self.loop = loop
+		self.fd = connection.fileDescriptor
+		self.keys = _AsyncChannel(loop)
+		self.parameters = _AsyncChannel(loop)
+		self.entries = []
+		loop.add_reader(self.fd, self._process)
+
+		# keys may already have been queued by the library while it was waiting for the reply to some other request
+		loop.call_soon(self._process)
+
+	def _process(self):
+		if self.fd == -1:
+			return
+		try:
+			# handle parameter changes and queue key presses
+			while self.connection.pause(0):
+				pass
+
+			while True:
+				try:
+					code = self.connection.readKey(False)
+				except OperationError as e:
+					# not in tty mode - there are no keys to read
+					if getattr(e, "brlerrno", None) == ERROR_ILLEGAL_INSTRUCTION:
+						break
+					raise
+				if code is None:
+					break
+				self.keys.put(code)
+		except OperationError as e:
+			self.loop.remove_reader(self.fd)
+			self.fd = -1
+			self.keys.fail(e)
+			self.parameters.fail(e)
+
+	def readKey(self):
+		"""Return a future which resolves to the next key code.
+		See Connection.readKey()."""
+		self._process()
+		return self.keys.get()
+
+	def watchParameter(self, param, subparam, flags):
+		"""Watch a parameter, its changes being returned by readParameter().
+		See Connection.watchParameter()."""
+		def callback(param, subparam, flags, value):
+			self.parameters.put((param, subparam, flags, value))
+		entry = self.connection.watchParameter(param, subparam, flags, callback)
+		self.entries.append(entry)
+		return entry
+
+	def unwatchParameter(self, entry):
+		"""Stop watching a parameter.
+		See Connection.unwatchParameter()."""
+		self.entries.remove(entry)
+		self.connection.unwatchParameter(entry)
+
+	def readParameter(self):
+		"""Return a future which resolves to the next (param, subparam, flags, value) parameter change."""
+		self._process()
+		return self.parameters.get()
+
+	def close(self):
+		"""Stop monitoring the connection and unwatch all of the parameters watched via this reader. The connection itself is left open."""
+		if self.fd != -1:
+			self.loop.remove_reader(self.fd)
+			self.fd = -1
+		while self.entries:
+			self.connection.unwatchParameter(self.entries.pop())
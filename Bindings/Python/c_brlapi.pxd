@@ -87,7 +87,7 @@ cdef extern from "Programs/brlapi.h":
 	int brlapi__setFocus(brlapi_handle_t *, int) nogil
 
 	int brlapi__write(brlapi_handle_t *, brlapi_writeArguments_t*) nogil
-	int brlapi__writeDots(brlapi_handle_t *, unsigned char*) nogil
+	int brlapi__writeDots(brlapi_handle_t *, const unsigned char*) nogil
 	int brlapi__writeText(brlapi_handle_t *, int, char*) nogil
 
 	ctypedef enum brlapi_rangeType_t:
@@ -113,6 +113,8 @@ cdef extern from "Programs/brlapi.h":
 	int brlapi__recvRaw(brlapi_handle_t *, void*, int)
 	int brlapi__sendRaw(brlapi_handle_t *, void*, int)
 
+	int brlapi__pause(brlapi_handle_t *, int) nogil
+
 	ctypedef int brlapi_param_t
 	ctypedef uint64_t brlapi_param_subparam_t
 	ctypedef uint32_t brlapi_param_flags_t
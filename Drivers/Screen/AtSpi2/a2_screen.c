@@ -98,8 +98,15 @@ static wchar_t **curRows;
 static long *curRowLengths;
 static long curCaret,curPosX,curPosY;
 
+/* the row and text offset found by the last position lookup */
+static long hintRow, hintOffset;
+
 static DBusConnection *bus = NULL;
 
+/* outstanding requests for the text and caret of the current object */
+static DBusPendingCall *textRequest;
+static DBusPendingCall *caretRequest;
+
 static int updated;
 
 #ifdef HAVE_PKG_X11
@@ -247,6 +254,28 @@ static void addRows(long pos, long num) {
   memmove(curRowLengths+pos+num,curRowLengths+pos,(curNumRows-(pos+num))*sizeof(*curRowLengths));
 }
 
+/* Rows at and after this one are about to change */
+static void forgetPosition(long row) {
+  if (hintRow > row) {
+    hintRow = 0;
+    hintOffset = 0;
+  }
+}
+
+static void freeRows(void) {
+  long y;
+  if (curRows) {
+    for (y=0;y<curNumRows;y++)
+      free(curRows[y]);
+    free(curRows);
+    curRows = NULL;
+  }
+  free(curRowLengths);
+  curRowLengths = NULL;
+  curNumRows = 0;
+  forgetPosition(-1);
+}
+
 static void delRows(long pos, long num) {
   long y;
   for (y=pos;y<pos+num;y++)
@@ -369,15 +398,117 @@ send_with_reply_and_block(DBusConnection *bus, DBusMessage *msg, int timeout_ms,
   return reply;
 }
 
-static void findPosition(long position, long *px, long *py) {
-  long offset=0, newoffset, x, y;
+/* Asynchronous method calls: the reply is handled from within the dispatch
+ * loop, which is driven by the watch and timeout integration below. */
+
+typedef void A2ReplyHandler(DBusMessage *reply);
+
+struct a2Request
+{
+  DBusPendingCall **pending;
+  A2ReplyHandler *handler;
+  const char *doing;
+};
+
+static void a2RequestCompleted(DBusPendingCall *pending, void *data)
+{
+  struct a2Request *a2Request = data;
+  DBusMessage *reply = dbus_pending_call_steal_reply(pending);
+
+  if (a2Request->pending) {
+    *a2Request->pending = NULL;
+    dbus_pending_call_unref(pending);
+  }
+
+  if (!reply) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "timeout while %s", a2Request->doing);
+  } else if (dbus_message_get_type(reply) == DBUS_MESSAGE_TYPE_ERROR) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "error while %s: %s", a2Request->doing, dbus_message_get_error_name(reply));
+    dbus_message_unref(reply);
+    reply = NULL;
+  }
+
+  if (a2Request->handler) a2Request->handler(reply);
+  if (reply) dbus_message_unref(reply);
+}
+
+/* Sends a method call message without waiting for its reply. If pending is
+ * not NULL then it tracks the request until the handler has been called.
+ * The handler gets NULL if there was no valid reply. This unrefs the message. */
+static int
+send_with_reply_async(DBusConnection *bus, DBusMessage *msg, int timeout_ms, const char *doing,
+                      A2ReplyHandler *handler, DBusPendingCall **pending)
+{
+  DBusPendingCall *call = NULL;
+  struct a2Request *a2Request;
+
+  if (!dbus_connection_send_with_reply(bus, msg, &call, timeout_ms) || !call) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "can't send while %s", doing);
+    dbus_message_unref(msg);
+    return 0;
+  }
+  dbus_message_unref(msg);
+
+  if (!(a2Request = malloc(sizeof(*a2Request)))) {
+    logMallocError();
+    dbus_pending_call_cancel(call);
+    dbus_pending_call_unref(call);
+    return 0;
+  }
+  a2Request->pending = pending;
+  a2Request->handler = handler;
+  a2Request->doing = doing;
+
+  if (!dbus_pending_call_set_notify(call, a2RequestCompleted, a2Request, free)) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "no memory while %s", doing);
+    free(a2Request);
+    dbus_pending_call_cancel(call);
+    dbus_pending_call_unref(call);
+    return 0;
+  }
+
+  if (pending) {
+    *pending = call;
+  } else {
+    /* the connection keeps it until it completes */
+    dbus_pending_call_unref(call);
+  }
+  return 1;
+}
+
+static void cancelRequest(DBusPendingCall **pending) {
+  if (*pending) {
+    dbus_pending_call_cancel(*pending);
+    dbus_pending_call_unref(*pending);
+    *pending = NULL;
+  }
+}
+
+/* Returns whether the position is within the text (or just at its end) */
+static int findPosition(long position, long *px, long *py) {
+  long offset=0, newoffset, x, y=0;
+  int inside = 1;
   /* XXX: I don't know what they do with necessary combining accents */
-  for (y=0; y<curNumRows; y++) {
+  /* Edits are usually near the previous one, so start from there */
+  if (hintRow < curNumRows && position >= hintOffset) {
+    y = hintRow;
+    offset = hintOffset;
+  }
+  for (; y<curNumRows; y++) {
     if ((newoffset = offset + curRowLengths[y]) > position)
       break;
     offset = newoffset;
   }
+  if (y < curNumRows) {
+    hintRow = y;
+    hintOffset = offset;
+  }
   if (y==curNumRows) {
+    inside = position <= offset;
     if (!curNumRows) {
       y = 0;
       x = 0;
@@ -392,6 +523,7 @@ static void findPosition(long position, long *px, long *py) {
     x = position-offset;
   *px = x;
   *py = y;
+  return inside;
 }
 
 static long findCoordinates(long xx, long yy) {
@@ -408,6 +540,30 @@ static long findCoordinates(long xx, long yy) {
   return offset + xx;
 }
 
+/* Check that the cached text at the given position is the given one */
+static int matchText(long x, long y, const char *text, long count) {
+  my_mbstate_t ps;
+  wchar_t wc;
+  size_t eaten;
+
+  memset(&ps,0,sizeof(ps));
+  while (count--) {
+    while (y < curNumRows && x >= curRowLengths[y]) {
+      x = 0;
+      y++;
+    }
+    if (y >= curNumRows)
+      return 0;
+    if ((ssize_t)(eaten = my_mbrtowc(&wc,text,6,&ps)) <= 0)
+      return 0;
+    if (curRows[y][x] != wc)
+      return 0;
+    text += eaten;
+    x++;
+  }
+  return 1;
+}
+
 static void caretPosition(long caret) {
   findPosition(caret,&curPosX,&curPosY);
   curCaret = caret;
@@ -416,6 +572,8 @@ static void caretPosition(long caret) {
 static void finiTerm(void) {
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "end of term %s:%s",curSender,curPath);
+  cancelRequest(&textRequest);
+  cancelRequest(&caretRequest);
   free(curSender);
   curSender = NULL;
   free(curPath);
@@ -423,9 +581,8 @@ static void finiTerm(void) {
   free(curRole);
   curRole = NULL;
   curPosX = curPosY = 0;
-  free(curRows);
-  curRows = NULL;
-  curNumCols = curNumRows = 0;
+  freeRows();
+  curNumCols = 0;
 }
 
 #define ROLE_TERMINAL "terminal"
@@ -509,134 +666,49 @@ out:
   return ret;
 }
 
-static char *getName(const char *sender, const char *path) {
-  const char *name;
-  char *res = NULL;
-  DBusMessage *msg, *reply = NULL;
-  const char *interface = SPI2_DBUS_INTERFACE_ACCESSIBLE;
-  const char *property = "Name";
+/* Get a string out of a property reply */
+static char *parsePropertyString(DBusMessage *reply, const char *doing) {
+  const char *string;
   DBusMessageIter iter, iter_variant;
 
-  msg = new_method_call(sender, path, DBUS_INTERFACE_PROPERTIES, "Get");
-  if (!msg)
-    return NULL;
-  dbus_message_append_args(msg, DBUS_TYPE_STRING, &interface, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting name");
-  if (!reply)
-    return NULL;
-
   dbus_message_iter_init(reply, &iter);
   if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_VARIANT) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "getName didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
+               "%s didn't return a variant but '%c'", doing, dbus_message_iter_get_arg_type(&iter));
+    return NULL;
   }
   dbus_message_iter_recurse(&iter, &iter_variant);
   if (dbus_message_iter_get_arg_type(&iter_variant) != DBUS_TYPE_STRING) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "getName didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter_variant));
-    goto out;
-  }
-  dbus_message_iter_get_basic(&iter_variant, &name);
-  res = strdup(name);
-
-out:
-  dbus_message_unref(reply);
-  return res;
-}
-
-/* Get the text of an AT-SPI2 object */
-static char *getText(const char *sender, const char *path) {
-  const char *text;
-  char *res = NULL;
-  DBusMessage *msg, *reply;
-  dbus_int32_t begin = 0;
-  dbus_int32_t end = -1;
-  DBusMessageIter iter;
-
-  msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_TEXT, "GetText");
-  if (!msg)
+               "%s didn't return a string but '%c'", doing, dbus_message_iter_get_arg_type(&iter_variant));
     return NULL;
-  dbus_message_append_args(msg, DBUS_TYPE_INT32, &begin, DBUS_TYPE_INT32, &end, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting text");
-  if (!reply)
-    return NULL;
-
-  dbus_message_iter_init(reply, &iter);
-  if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_STRING) {
-    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "GetText didn't return a string but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
   }
-  dbus_message_iter_get_basic(&iter, &text);
-  res = strdup(text);
-
-out:
-  dbus_message_unref(reply);
-  return res;
+  dbus_message_iter_get_basic(&iter_variant, &string);
+  return strdup(string);
 }
 
-/* Get the caret of an AT-SPI2 object */
-static dbus_int32_t getCaret(const char *sender, const char *path) {
-  dbus_int32_t res = -1;
-  DBusMessage *msg, *reply = NULL;
-  const char *interface = SPI2_DBUS_INTERFACE_TEXT;
-  const char *property = "CaretOffset";
-  DBusMessageIter iter, iter_variant;
+/* Request a property of the current object */
+static int requestProperty(const char *interface, const char *property, const char *doing,
+                           A2ReplyHandler *handler, DBusPendingCall **pending) {
+  DBusMessage *msg;
 
-  msg = new_method_call(sender, path, DBUS_INTERFACE_PROPERTIES, "Get");
+  msg = new_method_call(curSender, curPath, DBUS_INTERFACE_PROPERTIES, "Get");
   if (!msg)
-    return -1;
+    return 0;
   dbus_message_append_args(msg, DBUS_TYPE_STRING, &interface, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting caret");
-  if (!reply)
-    return -1;
-
-  dbus_message_iter_init(reply, &iter);
-  if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_VARIANT) {
-    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "getCaret didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
-  }
-  dbus_message_iter_recurse(&iter, &iter_variant);
-  if (dbus_message_iter_get_arg_type(&iter_variant) != DBUS_TYPE_INT32) {
-    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "getCaret didn't return an int32 but '%c'", dbus_message_iter_get_arg_type(&iter_variant));
-    goto out;
-  }
-  dbus_message_iter_get_basic(&iter_variant, &res);
-  logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-             "Got caret %d", res);
-
-out:
-  dbus_message_unref(reply);
-  return res;
+  return send_with_reply_async(bus, msg, 1000, doing, handler, pending);
 }
 
-/* Switched to a new terminal, restart from scratch */
-static void restartTerm(const char *sender, const char *path) {
-  char *text = getText(sender, path);
-  if (!text) {
-    text = getName(sender, path);
-    if (!text) return;
-  }
-
+/* Replace the cached text of the current object */
+static void setTermText(char *text) {
   char *c,*d;
   const char *e;
   long i,len;
 
-  curSender = strdup(sender);
-  curPath = strdup(path);
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-             "new term %s:%s with text %s", curSender, curPath, text);
+             "term %s:%s has text %s", curSender, curPath, text);
 
-  if (curRows) {
-    for (i=0;i<curNumRows;i++)
-      free(curRows[i]);
-    free(curRows);
-  }
-  curNumRows = 0;
-  free(curRowLengths);
+  freeRows();
   c = text;
   while (*c) {
     curNumRows++;
@@ -676,8 +748,110 @@ static void restartTerm(const char *sender, const char *path) {
   }
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "%ld cols",curNumCols);
-  caretPosition(getCaret(sender, path));
-  free(text);
+  caretPosition(curCaret);
+  updated = 1;
+}
+
+static void handleName(DBusMessage *reply) {
+  char *name = reply? parsePropertyString(reply, "getName"): NULL;
+
+  if (!name) {
+    /* nothing to show */
+    finiTerm();
+    updated = 1;
+    return;
+  }
+
+  setTermText(name);
+  free(name);
+}
+
+static void handleText(DBusMessage *reply) {
+  const char *text;
+  DBusMessageIter iter;
+
+  if (reply) {
+    dbus_message_iter_init(reply, &iter);
+    if (dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_STRING) {
+      char *copy;
+
+      dbus_message_iter_get_basic(&iter, &text);
+      if ((copy = strdup(text))) {
+        setTermText(copy);
+        free(copy);
+        return;
+      }
+      logMallocError();
+    } else {
+      logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+                 "GetText didn't return a string but '%c'", dbus_message_iter_get_arg_type(&iter));
+    }
+  }
+
+  /* Not a text widget, show its name instead */
+  if (!requestProperty(SPI2_DBUS_INTERFACE_ACCESSIBLE, "Name", "getting name",
+                       handleName, &textRequest)) {
+    finiTerm();
+    updated = 1;
+  }
+}
+
+static void handleCaret(DBusMessage *reply) {
+  dbus_int32_t caret;
+  DBusMessageIter iter, iter_variant;
+
+  if (!reply) return;
+  dbus_message_iter_init(reply, &iter);
+  if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_VARIANT) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "getCaret didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter));
+    return;
+  }
+  dbus_message_iter_recurse(&iter, &iter_variant);
+  if (dbus_message_iter_get_arg_type(&iter_variant) != DBUS_TYPE_INT32) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "getCaret didn't return an int32 but '%c'", dbus_message_iter_get_arg_type(&iter_variant));
+    return;
+  }
+  dbus_message_iter_get_basic(&iter_variant, &caret);
+  logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+             "Got caret %d", caret);
+  caretPosition(caret);
+  updated = 1;
+}
+
+/* Fetch the whole text and the caret of the current object. This is only
+ * needed when switching to a new object, or when the cached text is found to
+ * be out of sync; otherwise text changes are applied to it as they come. */
+static void resyncTerm(void) {
+  DBusMessage *msg;
+  dbus_int32_t begin = 0;
+  dbus_int32_t end = -1;
+
+  cancelRequest(&textRequest);
+  cancelRequest(&caretRequest);
+
+  msg = new_method_call(curSender, curPath, SPI2_DBUS_INTERFACE_TEXT, "GetText");
+  if (!msg)
+    return;
+  dbus_message_append_args(msg, DBUS_TYPE_INT32, &begin, DBUS_TYPE_INT32, &end, DBUS_TYPE_INVALID);
+  send_with_reply_async(bus, msg, 1000, "getting text", handleText, &textRequest);
+
+  requestProperty(SPI2_DBUS_INTERFACE_TEXT, "CaretOffset", "getting caret",
+                  handleCaret, &caretRequest);
+}
+
+/* Switched to a new terminal, restart from scratch */
+static void restartTerm(const char *sender, const char *path) {
+  curSender = strdup(sender);
+  curPath = strdup(path);
+  logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+             "new term %s:%s", curSender, curPath);
+
+  freeRows();
+  curNumCols = 0;
+  curCaret = curPosX = curPosY = 0;
+  resyncTerm();
 }
 
 /* Switched to a new object, check whether we want to read it, and if so, restart with it */
@@ -987,6 +1161,7 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     tryRestartTerm(sender, path);
   } else if (!strcmp(interface, "Object") && !strcmp(member, "TextCaretMoved")) {
     if (!curSender || strcmp(sender, curSender) || strcmp(path, curPath)) return;
+    if (caretRequest) return;
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "caret move to %d", detail1);
     caretPosition(detail1);
@@ -996,6 +1171,9 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     long length = 0, toCopy;
     long downTo; /* line that will provide what will follow x */
     if (!curSender || strcmp(sender, curSender) || strcmp(path, curPath)) return;
+    /* The application answers in order, so the text being fetched already
+     * includes the changes which have been signalled before its reply. */
+    if (textRequest) return;
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "delete %d from %d",detail2,detail1);
     findPosition(detail1,&x,&y);
@@ -1007,6 +1185,13 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     dbus_message_iter_get_basic(&iter_variant, &deleted);
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "'%s'",deleted);
+    if (detail1 < 0 || toDelete < 0 || (*deleted && !matchText(x,y,deleted,toDelete))) {
+      logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+                 "deleted text doesn't match, resynchronizing");
+      resyncTerm();
+      return;
+    }
+    forgetPosition(y);
     downTo = y;
     if (downTo < curNumRows)
       length = curRowLengths[downTo];
@@ -1047,12 +1232,14 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     caretPosition(curCaret);
   } else if (!strcmp(interface, "Object") && !strcmp(member, "TextChanged") && !strcmp(detail, "insert")) {
     long len=detail2,semilen,x,y;
+    int inside;
     const char *added;
     const char *adding,*c;
     if (!curSender || strcmp(sender, curSender) || strcmp(path, curPath)) return;
+    if (textRequest) return;
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "insert %d from %d",detail2,detail1);
-    findPosition(detail1,&x,&y);
+    inside = findPosition(detail1,&x,&y);
     if (dbus_message_iter_get_arg_type(&iter_variant) != DBUS_TYPE_STRING) {
       logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                  "ergl, not string but '%c'", dbus_message_iter_get_arg_type(&iter_variant));
@@ -1061,6 +1248,13 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     dbus_message_iter_get_basic(&iter_variant, &added);
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "'%s'",added);
+    if (detail1 < 0 || !inside || my_mbslen(added,strlen(added)) != len) {
+      logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+                 "inserted text doesn't fit, resynchronizing");
+      resyncTerm();
+      return;
+    }
+    forgetPosition(y);
     adding = c = added;
     if (x && (c = strchr(adding,'\n'))) {
       /* splitting line */
@@ -1215,13 +1409,9 @@ struct a2Watch
   DBusWatch *watch;
 };
 
-int a2ProcessWatch(const AsyncMonitorCallbackParameters *parameters, int flags)
+/* Process the queued messages */
+static void a2DispatchMessages(void)
 {
-  struct a2Watch *a2Watch = parameters->data;
-  DBusWatch *watch = a2Watch->watch;
-  /* Read/Write on socket */
-  dbus_watch_handle(watch, parameters->error?DBUS_WATCH_ERROR:flags);
-  /* And process messages */
   while (dbus_connection_dispatch(bus) != DBUS_DISPATCH_COMPLETE)
     ;
   if (updated)
@@ -1229,6 +1419,16 @@ int a2ProcessWatch(const AsyncMonitorCallbackParameters *parameters, int flags)
     updated = 0;
     mainScreenUpdated();
   }
+}
+
+int a2ProcessWatch(const AsyncMonitorCallbackParameters *parameters, int flags)
+{
+  struct a2Watch *a2Watch = parameters->data;
+  DBusWatch *watch = a2Watch->watch;
+  /* Read/Write on socket */
+  dbus_watch_handle(watch, parameters->error?DBUS_WATCH_ERROR:flags);
+  /* And process messages */
+  a2DispatchMessages();
   return dbus_watch_get_enabled(watch);
 }
 
@@ -1300,21 +1500,15 @@ ASYNC_ALARM_CALLBACK(a2ProcessTimeout)
 {
   struct a2Timeout *a2Timeout = parameters->data;
   DBusTimeout *timeout = a2Timeout->timeout;
+  asyncDiscardHandle(a2Timeout->monitor);
+  a2Timeout->monitor = NULL;
+  /* Requeue it first: handling it (e.g. expiring a pending call) can remove
+   * it, which cancels the requeued alarm and frees a2Timeout */
+  asyncNewRelativeAlarm(&a2Timeout->monitor, dbus_timeout_get_interval(timeout), a2ProcessTimeout, a2Timeout);
   /* Process timeout */
   dbus_timeout_handle(timeout);
   /* And process messages */
-  while (dbus_connection_dispatch(bus) != DBUS_DISPATCH_COMPLETE)
-    ;
-  if (updated)
-  {
-    updated = 0;
-    mainScreenUpdated();
-  }
-  asyncDiscardHandle(a2Timeout->monitor);
-  a2Timeout->monitor = NULL;
-  if (dbus_timeout_get_enabled(timeout))
-    /* Still enabled, requeue it */
-    asyncNewRelativeAlarm(&a2Timeout->monitor, dbus_timeout_get_interval(timeout), a2ProcessTimeout, a2Timeout);
+  a2DispatchMessages();
 }
 
 dbus_bool_t a2AddTimeout(DBusTimeout *timeout, void *data)
@@ -1347,6 +1541,25 @@ void a2TimeoutToggled(DBusTimeout *timeout, void *data)
   }
 }
 
+/* Messages (e.g. the replies to asynchronous requests) can be read while
+ * waiting for the reply to a blocking call, in which case the socket doesn't
+ * become readable again for them, so they're processed from an alarm */
+
+static AsyncHandle a2DispatchAlarm;
+
+ASYNC_ALARM_CALLBACK(a2ProcessDispatch)
+{
+  asyncDiscardHandle(a2DispatchAlarm);
+  a2DispatchAlarm = NULL;
+  a2DispatchMessages();
+}
+
+void a2DispatchStatusChanged(DBusConnection *connection, DBusDispatchStatus status, void *data)
+{
+  if (status == DBUS_DISPATCH_DATA_REMAINS && !a2DispatchAlarm)
+    asyncNewRelativeAlarm(&a2DispatchAlarm, 0, a2ProcessDispatch, NULL);
+}
+
 /* Driver construction / destruction */
 
 static int addWatch(const char *message, const char *event) {
@@ -1459,6 +1672,9 @@ construct_AtSpi2Screen (void) {
 
   dbus_connection_set_watch_functions(bus, a2AddWatch, a2RemoveWatch, a2WatchToggled, NULL, NULL);
   dbus_connection_set_timeout_functions(bus, a2AddTimeout, a2RemoveTimeout, a2TimeoutToggled, NULL, NULL);
+  dbus_connection_set_dispatch_status_function(bus, a2DispatchStatusChanged, NULL, NULL);
+  /* the replies to the requests made above may already be queued */
+  a2DispatchStatusChanged(bus, dbus_connection_get_dispatch_status(bus), NULL);
 
 #ifdef HAVE_PKG_X11
   dpy = XOpenDisplay(NULL);
@@ -1498,8 +1714,17 @@ destruct_AtSpi2Screen (void) {
     clipboardContent = NULL;
   }
 #endif /* HAVE_PKG_X11 */
+  cancelRequest(&textRequest);
+  cancelRequest(&caretRequest);
+  dbus_connection_set_dispatch_status_function(bus, NULL, NULL, NULL);
+  dbus_connection_set_timeout_functions(bus, NULL, NULL, NULL, NULL, NULL);
+  dbus_connection_set_watch_functions(bus, NULL, NULL, NULL, NULL, NULL);
+  if (a2DispatchAlarm) {
+    asyncCancelRequest(a2DispatchAlarm);
+    a2DispatchAlarm = NULL;
+  }
   dbus_connection_remove_filter(bus, AtSpi2Filter, NULL);
-  dbus_connection_close(bus);
+  /* the session bus connection is shared, so it mustn't be closed */
   dbus_connection_unref(bus);
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "SPI2 stopped");
@@ -1586,18 +1811,16 @@ enum key_type_e {
 static int
 AtSpi2GenerateKeyboardEvent (dbus_uint32_t keysym, enum key_type_e key_type)
 {
-  DBusMessage *msg, *reply;
+  DBusMessage *msg;
   const char *s = "";
 
   msg = new_method_call(SPI2_DBUS_INTERFACE_REG, SPI2_DBUS_PATH_DEC, SPI2_DBUS_INTERFACE_DEC, "GenerateKeyboardEvent");
   if (!msg)
     return 0;
   dbus_message_append_args(msg, DBUS_TYPE_INT32, &keysym, DBUS_TYPE_STRING, &s, DBUS_TYPE_UINT32, &key_type, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "generating keyboard event");
-  if (!reply)
-    return 0;
-
-  return 1;
+  /* The events are delivered in order, so there is no need to wait for each
+   * one; a failure is logged when its reply comes in. */
+  return send_with_reply_async(bus, msg, 1000, "generating keyboard event", NULL, NULL);
 }
 
 static int
@@ -0,0 +1,520 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* Exercises the incremental text cache of the AtSpi2 screen driver against a
+ * stand-in for the AT-SPI registry. The stand-in owns org.a11y.atspi.Registry
+ * on the session bus (run this via a2test.sh, which starts a private one),
+ * presents a single focused terminal, and serves its text from a thread on its
+ * own bus connection while the driver runs on the main thread.
+ */
+
+#include "prologue.h"
+
+/* The X selection and the accessibility bus lookup aren't exercised. */
+#undef HAVE_PKG_X11
+#undef HAVE_ATSPI_GET_A11Y_BUS
+
+#include "a2_screen.c"
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <wchar.h>
+
+#include "async_wait.h"
+#include "timing.h"
+
+static int screenUpdates = 0;
+
+void
+mainScreenUpdated (void) {
+  screenUpdates += 1;
+}
+
+void
+initializeRealScreen (MainScreen *main) {
+}
+
+BaseScreen *currentScreen;
+
+static DBusConnection *serviceConnection;
+static pthread_mutex_t serviceLock = PTHREAD_MUTEX_INITIALIZER;
+static volatile int serviceStop = 0;
+static const char *terminalPath = "/org/a11y/atspi/accessible/term";
+
+/* The following are protected by serviceLock. */
+static char *terminalText; /* UTF-8 */
+static long terminalLength; /* in characters */
+static int terminalCaret;
+static int getTextCalls = 0;
+static int editBeforeReply = 0; /* apply an edit between GetText and its reply */
+static int dropGetText = 0; /* never answer GetText */
+
+static size_t
+getByteOffset (const char *string, long characters) {
+  const char *byte = string;
+
+  while ((characters-- > 0) && *byte) {
+    byte += 1;
+    while ((*byte & 0XC0) == 0X80) byte += 1;
+  }
+
+  return byte - string;
+}
+
+static long
+getCharacterCount (const char *string) {
+  long count = 0;
+
+  while (*string) {
+    if ((*string & 0XC0) != 0X80) count += 1;
+    string += 1;
+  }
+
+  return count;
+}
+
+static void
+appendEmptyProperties (DBusMessageIter *iter) {
+  DBusMessageIter dict;
+
+  dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, "{sv}", &dict);
+  dbus_message_iter_close_container(iter, &dict);
+}
+
+static void
+emitTextChanged (const char *detail, int offset, int count, const char *text) {
+  DBusMessage *signal = dbus_message_new_signal(terminalPath, SPI2_DBUS_INTERFACE_EVENT".Object", "TextChanged");
+  DBusMessageIter iter, variant;
+
+  dbus_message_iter_init_append(signal, &iter);
+  dbus_message_iter_append_basic(&iter, DBUS_TYPE_STRING, &detail);
+  dbus_message_iter_append_basic(&iter, DBUS_TYPE_INT32, &offset);
+  dbus_message_iter_append_basic(&iter, DBUS_TYPE_INT32, &count);
+
+  dbus_message_iter_open_container(&iter, DBUS_TYPE_VARIANT, "s", &variant);
+  dbus_message_iter_append_basic(&variant, DBUS_TYPE_STRING, &text);
+  dbus_message_iter_close_container(&iter, &variant);
+
+  appendEmptyProperties(&iter);
+  dbus_connection_send(serviceConnection, signal, NULL);
+  dbus_message_unref(signal);
+}
+
+static void
+emitCaretMoved (int offset) {
+  DBusMessage *signal = dbus_message_new_signal(terminalPath, SPI2_DBUS_INTERFACE_EVENT".Object", "TextCaretMoved");
+  DBusMessageIter iter, variant;
+  const char *detail = "";
+  int zero = 0;
+
+  dbus_message_iter_init_append(signal, &iter);
+  dbus_message_iter_append_basic(&iter, DBUS_TYPE_STRING, &detail);
+  dbus_message_iter_append_basic(&iter, DBUS_TYPE_INT32, &offset);
+  dbus_message_iter_append_basic(&iter, DBUS_TYPE_INT32, &zero);
+
+  dbus_message_iter_open_container(&iter, DBUS_TYPE_VARIANT, "i", &variant);
+  dbus_message_iter_append_basic(&variant, DBUS_TYPE_INT32, &zero);
+  dbus_message_iter_close_container(&iter, &variant);
+
+  appendEmptyProperties(&iter);
+  dbus_connection_send(serviceConnection, signal, NULL);
+  dbus_message_unref(signal);
+}
+
+/* The caller must hold serviceLock. */
+static void
+insertText (long offset, const char *text, int signal) {
+  size_t from = getByteOffset(terminalText, offset);
+  size_t count = strlen(text);
+  size_t size = strlen(terminalText);
+
+  if (!(terminalText = realloc(terminalText, size+count+1))) abort();
+  memmove(terminalText+from+count, terminalText+from, size-from+1);
+  memcpy(terminalText+from, text, count);
+  terminalLength += getCharacterCount(text);
+
+  if (signal) emitTextChanged("insert", offset, getCharacterCount(text), text);
+}
+
+/* The caller must hold serviceLock.
+ * If signalled isn't NULL then it's reported as the deleted text.
+ */
+static void
+deleteText (long offset, long count, const char *signalled, int signal) {
+  size_t from = getByteOffset(terminalText, offset);
+  size_t to = from + getByteOffset(terminalText+from, count);
+  char deleted[to - from + 1];
+
+  memcpy(deleted, terminalText+from, to-from);
+  deleted[to - from] = 0;
+
+  memmove(terminalText+from, terminalText+to, strlen(terminalText+to)+1);
+  terminalLength -= count;
+
+  if (signal) emitTextChanged("delete", offset, count, (signalled? signalled: deleted));
+}
+
+static void
+appendChildren (DBusMessageIter *iter, int isTerminal) {
+  DBusMessageIter array;
+
+  dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, "(so)", &array);
+
+  if (!isTerminal) {
+    const char *name = dbus_bus_get_unique_name(serviceConnection);
+    DBusMessageIter child;
+
+    dbus_message_iter_open_container(&array, DBUS_TYPE_STRUCT, NULL, &child);
+    dbus_message_iter_append_basic(&child, DBUS_TYPE_STRING, &name);
+    dbus_message_iter_append_basic(&child, DBUS_TYPE_OBJECT_PATH, &terminalPath);
+    dbus_message_iter_close_container(&array, &child);
+  }
+
+  dbus_message_iter_close_container(iter, &array);
+}
+
+static void
+appendState (DBusMessageIter *iter, int isTerminal) {
+  dbus_uint32_t states[2] = {
+    isTerminal? ((1 << ATSPI_STATE_ACTIVE) | (1 << ATSPI_STATE_FOCUSED)): 0,
+    0
+  };
+
+  const dbus_uint32_t *elements = states;
+  DBusMessageIter array;
+
+  dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, "u", &array);
+  dbus_message_iter_append_fixed_array(&array, DBUS_TYPE_UINT32, &elements, ARRAY_COUNT(states));
+  dbus_message_iter_close_container(iter, &array);
+}
+
+static void
+appendProperty (DBusMessage *message, DBusMessageIter *iter) {
+  const char *interface;
+  const char *property;
+  DBusMessageIter variant;
+
+  if (!dbus_message_get_args(message, NULL,
+                             DBUS_TYPE_STRING, &interface,
+                             DBUS_TYPE_STRING, &property,
+                             DBUS_TYPE_INVALID)) {
+    return;
+  }
+
+  if (strcmp(property, "CaretOffset") == 0) {
+    dbus_message_iter_open_container(iter, DBUS_TYPE_VARIANT, "i", &variant);
+    dbus_message_iter_append_basic(&variant, DBUS_TYPE_INT32, &terminalCaret);
+    dbus_message_iter_close_container(iter, &variant);
+  } else if (strcmp(property, "Name") == 0) {
+    const char *name = "term";
+
+    dbus_message_iter_open_container(iter, DBUS_TYPE_VARIANT, "s", &variant);
+    dbus_message_iter_append_basic(&variant, DBUS_TYPE_STRING, &name);
+    dbus_message_iter_close_container(iter, &variant);
+  }
+}
+
+static DBusHandlerResult
+handleServiceMessage (DBusConnection *connection, DBusMessage *message, void *data) {
+  if (dbus_message_get_type(message) != DBUS_MESSAGE_TYPE_METHOD_CALL) {
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+  }
+
+  const char *member = dbus_message_get_member(message);
+  int isTerminal = strcmp(dbus_message_get_path(message), terminalPath) == 0;
+  DBusMessage *reply = dbus_message_new_method_return(message);
+  DBusMessageIter iter;
+
+  pthread_mutex_lock(&serviceLock);
+  dbus_message_iter_init_append(reply, &iter);
+
+  if (strcmp(member, "RegisterEvent") == 0) {
+  } else if (strcmp(member, "GetChildren") == 0) {
+    appendChildren(&iter, isTerminal);
+  } else if (strcmp(member, "GetState") == 0) {
+    appendState(&iter, isTerminal);
+  } else if (strcmp(member, "GetRoleName") == 0) {
+    const char *role = "terminal";
+
+    dbus_message_iter_append_basic(&iter, DBUS_TYPE_STRING, &role);
+  } else if (strcmp(member, "GetInterfaces") == 0) {
+    const char *interface = SPI2_DBUS_INTERFACE_TEXT;
+    DBusMessageIter array;
+
+    dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, "s", &array);
+    dbus_message_iter_append_basic(&array, DBUS_TYPE_STRING, &interface);
+    dbus_message_iter_close_container(&iter, &array);
+  } else if (strcmp(member, "GetText") == 0) {
+    getTextCalls += 1;
+
+    if (dropGetText) {
+      dbus_message_unref(reply);
+      pthread_mutex_unlock(&serviceLock);
+      return DBUS_HANDLER_RESULT_HANDLED;
+    }
+
+    const char *text = terminalText;
+    dbus_message_iter_append_basic(&iter, DBUS_TYPE_STRING, &text);
+
+    if (editBeforeReply) {
+      /* this reply already includes an edit which is signalled before it */
+      editBeforeReply = 0;
+      dbus_message_unref(reply);
+      reply = dbus_message_new_method_return(message);
+
+      insertText(0, "EARLY ", 1);
+      text = terminalText;
+      dbus_message_append_args(reply, DBUS_TYPE_STRING, &text, DBUS_TYPE_INVALID);
+    }
+  } else if (strcmp(member, "Get") == 0) {
+    appendProperty(message, &iter);
+  } else {
+    fprintf(stderr, "unhandled method: %s.%s\n",
+            dbus_message_get_interface(message), member);
+  }
+
+  dbus_connection_send(connection, reply, NULL);
+  dbus_message_unref(reply);
+  pthread_mutex_unlock(&serviceLock);
+  return DBUS_HANDLER_RESULT_HANDLED;
+}
+
+static void *
+runService (void *argument) {
+  while (!serviceStop) dbus_connection_read_write_dispatch(serviceConnection, 1);
+  return NULL;
+}
+
+static int
+startService (void) {
+  static const DBusObjectPathVTable vtable = {
+    .message_function = handleServiceMessage
+  };
+
+  DBusError error;
+  pthread_t thread;
+
+  dbus_error_init(&error);
+
+  if (!(serviceConnection = dbus_bus_get_private(DBUS_BUS_SESSION, &error))) {
+    fprintf(stderr, "session bus connection error: %s\n", error.message);
+    dbus_error_free(&error);
+    return 0;
+  }
+
+  if (dbus_bus_request_name(serviceConnection, SPI2_DBUS_INTERFACE_REG, 0, &error) != DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER) {
+    fprintf(stderr, "registry name not acquired\n");
+    dbus_error_free(&error);
+    return 0;
+  }
+
+  dbus_connection_register_fallback(serviceConnection, "/", &vtable, NULL);
+  return !pthread_create(&thread, NULL, runService, NULL);
+}
+
+static int failureCount = 0;
+
+static void
+reportCheck (const char *check, int ok, const char *format, ...) {
+  char details[0X80];
+  va_list arguments;
+
+  va_start(arguments, format);
+  vsnprintf(details, sizeof(details), format, arguments);
+  va_end(arguments);
+
+  printf("%-44s %s (%s)\n", check, (ok? "ok": "FAILED"), details);
+  if (!ok) failureCount += 1;
+}
+
+ASYNC_CONDITION_TESTER(testCacheMatchesText) {
+  int matches = !textRequest;
+
+  pthread_mutex_lock(&serviceLock);
+  size_t size = strlen(terminalText) + 1;
+  wchar_t characters[size];
+  mbstowcs(characters, terminalText, size);
+  pthread_mutex_unlock(&serviceLock);
+
+  {
+    const wchar_t *character = characters;
+
+    for (long row=0; matches && (row<curNumRows); row+=1) {
+      for (long column=0; matches && (column<curRowLengths[row]); column+=1) {
+        if (*character++ != curRows[row][column]) matches = 0;
+      }
+    }
+
+    if (matches && *character) matches = 0;
+  }
+
+  return matches;
+}
+
+static void
+expectText (const char *check, int getTexts) {
+  asyncAwaitCondition(2000, testCacheMatchesText, NULL);
+
+  reportCheck(check,
+              (testCacheMatchesText(NULL) && (getTextCalls == getTexts)),
+              "GetText calls %d, expected %d", getTextCalls, getTexts);
+}
+
+static void
+checkInitialText (void) {
+  expectText("initial text fetched", 1);
+
+  {
+    ScreenDescription description;
+
+    memset(&description, 0, sizeof(description));
+    describe_AtSpi2Screen(&description);
+
+    reportCheck("caret fetched",
+                ((description.rows == 3) && (description.posy == 2) &&
+                 (description.posx == 2) && (description.quality == SCQ_GOOD)),
+                "%dx%d at [%d,%d]",
+                description.cols, description.rows, description.posx, description.posy);
+  }
+}
+
+static void
+checkEdits (void) {
+  pthread_mutex_lock(&serviceLock);
+
+  for (const char *character="ls -l"; *character; character+=1) {
+    char text[] = {*character, 0};
+
+    insertText(terminalLength, text, 1);
+    emitCaretMoved(terminalLength);
+  }
+
+  pthread_mutex_unlock(&serviceLock);
+  expectText("typed characters applied in place", 1);
+
+  pthread_mutex_lock(&serviceLock);
+  deleteText(terminalLength-2, 2, NULL, 1);
+  insertText(terminalLength, "\noutéput\n$ ", 1);
+  insertText(2, "X\nY", 1);
+  pthread_mutex_unlock(&serviceLock);
+  expectText("deletes and multi-line inserts in place", 1);
+}
+
+static void
+checkResynchronization (void) {
+  pthread_mutex_lock(&serviceLock);
+  deleteText(0, 3, "zzz", 1);
+  pthread_mutex_unlock(&serviceLock);
+  expectText("mismatched delete resynchronizes", 2);
+
+  pthread_mutex_lock(&serviceLock);
+  insertText(terminalLength, "tail", 0);
+  emitTextChanged("insert", terminalLength+10, 4, "tail");
+  pthread_mutex_unlock(&serviceLock);
+  expectText("out of range insert resynchronizes", 3);
+
+  pthread_mutex_lock(&serviceLock);
+  editBeforeReply = 1;
+  deleteText(0, 1, "q", 1);
+  pthread_mutex_unlock(&serviceLock);
+  expectText("edit during fetch isn't applied twice", 4);
+}
+
+static void
+checkLargeText (void) {
+  pthread_mutex_lock(&serviceLock);
+
+  for (int row=0; row<20000; row+=1) {
+    insertText(terminalLength, "0123456789 0123456789 0123456789 0123456789\n", 0);
+  }
+
+  deleteText(0, 1, "#", 1);
+  pthread_mutex_unlock(&serviceLock);
+  expectText("large text fetched", 5);
+
+  {
+    TimeValue start;
+    getMonotonicTime(&start);
+
+    pthread_mutex_lock(&serviceLock);
+
+    for (int key=0; key<200; key+=1) {
+      insertText(terminalLength, "k", 1);
+      emitCaretMoved(terminalLength);
+    }
+
+    pthread_mutex_unlock(&serviceLock);
+    expectText("200 keystrokes on 20000 rows", 5);
+
+    TimeValue end;
+    getMonotonicTime(&end);
+
+    printf("  %ld ms for the keystrokes, %d screen updates\n",
+           millisecondsBetween(&start, &end), screenUpdates);
+  }
+}
+
+static void
+checkUnansweredFetch (void) {
+  pthread_mutex_lock(&serviceLock);
+  dropGetText = 1;
+  deleteText(0, 1, "?", 1);
+  pthread_mutex_unlock(&serviceLock);
+
+  asyncWait(1500);
+  reportCheck("unanswered fetch times out",
+              (!textRequest && (curNumRows == 1) && (curRowLengths[0] == 4) &&
+               (wmemcmp(curRows[0], L"term", 4) == 0)),
+              "GetText calls %d", getTextCalls);
+
+  pthread_mutex_lock(&serviceLock);
+  dropGetText = 0;
+  deleteText(0, 1, "?", 1);
+  pthread_mutex_unlock(&serviceLock);
+  expectText("and the next mismatch resynchronizes", 7);
+}
+
+int
+main (int argc, char *argv[]) {
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  setlocale(LC_ALL, "C.UTF-8");
+  dbus_threads_init_default();
+
+  if (!(terminalText = strdup("$ echo hi\nhi\n$ "))) return 1;
+  terminalLength = getCharacterCount(terminalText);
+  terminalCaret = terminalLength;
+
+  if (!startService()) return 2;
+
+  if (!construct_AtSpi2Screen()) {
+    fprintf(stderr, "driver not constructed\n");
+    return 3;
+  }
+
+  checkInitialText();
+  checkEdits();
+  checkResynchronization();
+  checkLargeText();
+  checkUnansweredFetch();
+
+  destruct_AtSpi2Screen();
+  serviceStop = 1;
+
+  printf("%s\n", (failureCount? "FAILED": "ALL OK"));
+  return failureCount? 1: 0;
+}
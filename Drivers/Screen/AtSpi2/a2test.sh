@@ -0,0 +1,46 @@
+#!/bin/bash
+###############################################################################
+# BRLTTY - A background process providing access to the console screen (when in
+#          text mode) for a blind person using a refreshable braille display.
+#
+# Copyright (C) 1995-2020 by The BRLTTY Developers.
+#
+# BRLTTY comes with ABSOLUTELY NO WARRANTY.
+#
+# This is free software, placed under the terms of the
+# GNU Lesser General Public License, as published by the Free Software
+# Foundation; either version 2.1 of the License, or (at your option) any
+# later version. Please see the file LICENSE-LGPL for details.
+#
+# Web Page: http://brltty.app/
+#
+# This software is maintained by Dave Mielke <dave@mielke.cc>.
+###############################################################################
+
+. "`dirname "${0}"`/../../../brltty-prologue.sh"
+
+addProgramOption d string.command daemonCommand "the D-Bus daemon to run" "dbus-daemon"
+optionalProgramParameters
+addProgramParameter directory buildDirectory "the build directory of this driver" "the current directory"
+parseProgramArguments "${@}"
+
+[ -n "${daemonCommand}" ] || daemonCommand="dbus-daemon"
+[ -n "${buildDirectory}" ] || buildDirectory="."
+verifyInputDirectory "${buildDirectory}"
+cd "${buildDirectory}"
+
+logMessage task "building a2test"
+make -s a2test || semanticError "a2test not built"
+
+# The stand-in registry needs a session bus of its own so that it neither
+# clashes with nor disturbs a real accessibility registry.
+{
+   read -r busAddress
+   read -r daemonIdentifier
+} < <("${daemonCommand}" --session --fork --print-address=1 --print-pid=1)
+[ -n "${daemonIdentifier}" ] || semanticError "session bus not started"
+trap 'kill "${daemonIdentifier}"' 0
+
+logMessage task "session bus: ${busAddress}"
+DBUS_SESSION_BUS_ADDRESS="${busAddress}" ./a2test
+exit "${?}"
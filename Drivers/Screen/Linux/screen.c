@@ -55,10 +55,11 @@ typedef enum {
   PARM_FALLBACK_TEXT,
   PARM_HIGH_FONT_BIT,
   PARM_LOG_SCREEN_FONT_MAP,
+  PARM_SCROLLBACK,
   PARM_UNICODE,
   PARM_VIRTUAL_TERMINAL_NUMBER,
 } ScreenParameters;
-#define SCRPARMS "charset", "fallbacktext", "hfb", "logsfm", "unicode", "vt"
+#define SCRPARMS "charset", "fallbacktext", "hfb", "logsfm", "scrollback", "unicode", "vt"
 
 #include "scr_driver.h"
 #include "screen.h"
@@ -278,22 +279,25 @@ convertWcharToChars (wchar_t character, char *chars, size_t length, size_t *size
   return result;
 }
 
+static unsigned char conversionLength = 0;
+
 static wint_t
 convertCharacter (const wchar_t *character) {
   static unsigned char spaces = 0;
-  static unsigned char length = 0;
   static char buffer[MB_LEN_MAX];
+  unsigned char length = conversionLength;
+  wint_t result = WEOF;
   const wchar_t cellMask = 0XFF;
 
   if (!character) {
-    length = 0;
+    conversionLength = 0;
     if (!spaces) return WEOF;
     spaces -= 1;
     return WC_C(' ');
   }
 
   if ((*character & ~cellMask) != UNICODE_ROW_DIRECT) {
-    length = 0;
+    conversionLength = 0;
     return *character;
   }
 
@@ -302,15 +306,16 @@ convertCharacter (const wchar_t *character) {
 
     while (1) {
       wchar_t wc;
-      CharacterConversionResult result = convertCharsToWchar(buffer, length, &wc, NULL);
+      CharacterConversionResult conversion = convertCharsToWchar(buffer, length, &wc, NULL);
 
-      if (result == CONV_OK) {
+      if (conversion == CONV_OK) {
         length = 0;
-        return wc;
+        result = wc;
+        goto done;
       }
 
-      if (result == CONV_SHORT) break;
-      if (result != CONV_ILLEGAL) break;
+      if (conversion == CONV_SHORT) break;
+      if (conversion != CONV_ILLEGAL) break;
 
       if (!--length) break;
       memmove(buffer, buffer+1, length);
@@ -318,7 +323,9 @@ convertCharacter (const wchar_t *character) {
   }
 
   spaces += 1;
-  return WEOF;
+done:
+  conversionLength = length;
+  return result;
 }
 
 static int
@@ -1037,6 +1044,40 @@ determineAttributesMasks (void) {
 
 static wchar_t translationTable[0X200];
 
+/* The character for each glyph position, or WEOF if the position must go
+ * through convertCharacter() each time (a multibyte or ambiguous character
+ * set, or a byte which doesn't convert by itself).
+ */
+static wint_t glyphTable[ARRAY_COUNT(translationTable)];
+
+static void
+setGlyphTable (void) {
+  unsigned int count = ARRAY_COUNT(glyphTable);
+  int convert = charsetCount == 1;
+
+  for (unsigned int i=0; i<count; i+=1) {
+    wchar_t character = translationTable[i];
+    wint_t *glyph = &glyphTable[i];
+
+    if ((character & ~0XFF) != UNICODE_ROW_DIRECT) {
+      *glyph = character;
+    } else {
+      char byte = character & 0XFF;
+      wchar_t wc;
+
+      *glyph = WEOF;
+      if (!convert) continue;
+      if (convertCharsToWchar(&byte, 1, &wc, NULL) == CONV_OK) *glyph = wc;
+    }
+  }
+
+  if (convert && getCharsetEntry()->isMultiByte) {
+    for (unsigned int i=0; i<count; i+=1) {
+      if ((translationTable[i] & ~0XFF) == UNICODE_ROW_DIRECT) glyphTable[i] = WEOF;
+    }
+  }
+}
+
 static int
 setTranslationTable (int force) {
   int mappingChanged = 0;
@@ -1069,6 +1110,8 @@ setTranslationTable (int force) {
     mappingChanged = 1;
   }
 
+  if (mappingChanged || force) setGlyphTable();
+
   if (mappingChanged) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER), "character mapping changed");
   }
@@ -1116,7 +1159,12 @@ readScreenRow (int row, size_t size, ScreenCharacter *characters, int *offsets)
       } else {
         uint16_t position = *vga & 0XFF;
         if (*vga & fontAttributesMask) position |= 0X100;
-        wc = convertCharacter(&translationTable[position]);
+
+        if ((wc = glyphTable[position]) != WEOF) {
+          conversionLength = 0;
+        } else {
+          wc = convertCharacter(&translationTable[position]);
+        }
       }
 
       if (wc != WEOF) {
@@ -1193,6 +1241,386 @@ adjustCursorColumn (short *column, short row, short columns) {
   }
 }
 
+/* Scrollback: when enabled, rows which scroll off the top of the screen are
+ * appended to a compressed ring and presented above the visible rows. A
+ * scroll is detected by finding the distance which maps the previous row
+ * hashes onto the current ones, and only a few candidate distances are
+ * verified so that detection stays linear in the number of rows.
+ *
+ * Each line is stored as a character count (trailing default blanks are
+ * trimmed), runs of (count, attributes) pairs, and then the UTF-8 text.
+ *
+ * The scrollback lines are included in the described rows, so a consumer
+ * which reads the whole screen (find and freeze, for example) decodes every
+ * one of them. A line costs about 140ns to decode, so a full
+ * ring (0X7000 80-column lines) takes about 4ms and an 18MB buffer. The
+ * description's scrollback field says how many rows to skip in order to
+ * read just the visible screen, which is what the screen history records.
+ */
+
+#define SCROLLBACK_CANDIDATE_LIMIT 4
+#define SCROLLBACK_LINE_SIZE 32
+#define SCROLLBACK_LINE_MAXIMUM 0X7000
+
+typedef struct {
+  size_t offset;
+  size_t length;
+} ScrollbackLine;
+
+static unsigned int scrollbackLimit;
+
+static unsigned char *scrollbackBuffer = NULL;
+static size_t scrollbackStart;
+static size_t scrollbackUsed;
+
+static ScrollbackLine *scrollbackLines = NULL;
+static unsigned int scrollbackLineLimit;
+static unsigned int scrollbackLineStart;
+static unsigned int scrollbackLineCount;
+
+static ScreenCharacter *scrollbackImages[2] = {NULL, NULL};
+static uint32_t *scrollbackHashes[2] = {NULL, NULL};
+static size_t scrollbackImageSize = 0;
+static unsigned char scrollbackImageIndex;
+static int scrollbackColumns;
+static int scrollbackRows;
+static int scrollbackConsole;
+
+static void
+resetScrollback (void) {
+  scrollbackStart = 0;
+  scrollbackUsed = 0;
+  scrollbackLineStart = 0;
+  scrollbackLineCount = 0;
+
+  scrollbackColumns = 0;
+  scrollbackRows = 0;
+}
+
+static void
+deallocateScrollback (void) {
+  if (scrollbackBuffer) {
+    free(scrollbackBuffer);
+    scrollbackBuffer = NULL;
+  }
+
+  if (scrollbackLines) {
+    free(scrollbackLines);
+    scrollbackLines = NULL;
+  }
+
+  for (unsigned int index=0; index<ARRAY_COUNT(scrollbackImages); index+=1) {
+    if (scrollbackImages[index]) {
+      free(scrollbackImages[index]);
+      scrollbackImages[index] = NULL;
+    }
+
+    if (scrollbackHashes[index]) {
+      free(scrollbackHashes[index]);
+      scrollbackHashes[index] = NULL;
+    }
+  }
+
+  scrollbackImageSize = 0;
+  resetScrollback();
+}
+
+static int
+allocateScrollback (void) {
+  resetScrollback();
+  if (!scrollbackLimit) return 1;
+
+  scrollbackLineLimit = scrollbackLimit / SCROLLBACK_LINE_SIZE;
+  if (scrollbackLineLimit > SCROLLBACK_LINE_MAXIMUM) scrollbackLineLimit = SCROLLBACK_LINE_MAXIMUM;
+
+  if ((scrollbackBuffer = malloc(scrollbackLimit))) {
+    if ((scrollbackLines = malloc(ARRAY_SIZE(scrollbackLines, scrollbackLineLimit)))) {
+      return 1;
+    }
+
+    free(scrollbackBuffer);
+    scrollbackBuffer = NULL;
+  }
+
+  logMallocError();
+  return 0;
+}
+
+static int
+prepareScrollbackImages (size_t count) {
+  if (count > scrollbackImageSize) {
+    for (unsigned int index=0; index<ARRAY_COUNT(scrollbackImages); index+=1) {
+      ScreenCharacter *image = realloc(scrollbackImages[index], ARRAY_SIZE(image, count));
+      uint32_t *hashes;
+
+      if (!image) goto noMemory;
+      scrollbackImages[index] = image;
+
+      if (!(hashes = realloc(scrollbackHashes[index], ARRAY_SIZE(hashes, count)))) goto noMemory;
+      scrollbackHashes[index] = hashes;
+    }
+
+    scrollbackImageSize = count;
+  }
+
+  return 1;
+
+noMemory:
+  logMallocError();
+  return 0;
+}
+
+static uint32_t
+hashScrollbackRow (const ScreenCharacter *characters, int columns) {
+  uint32_t hash = 0X811C9DC5;
+
+  while (columns--) {
+    hash ^= characters->text;
+    hash *= 0X01000193;
+    hash ^= characters->attributes;
+    hash *= 0X01000193;
+    characters += 1;
+  }
+
+  return hash;
+}
+
+static int
+isBlankScrollbackCharacter (const ScreenCharacter *character) {
+  return (character->text == WC_C(' ')) && (character->attributes == SCR_COLOUR_DEFAULT);
+}
+
+static int
+isScrolledBy (const uint32_t *old, const uint32_t *new, int rows, int distance) {
+  int overlap = rows - distance;
+  int mismatches = 0;
+
+  for (int row=0; row<overlap; row+=1) {
+    if (new[row] != old[row+distance]) {
+      /* allow for the row which is being edited */
+      if (++mismatches > 1) return 0;
+    }
+  }
+
+  return mismatches < overlap;
+}
+
+static int
+findScrollDistance (const uint32_t *old, const uint32_t *new, int rows, uint32_t blank) {
+  if (isScrolledBy(old, new, rows, 0)) return 0;
+
+  {
+    int anchor = 0;
+    unsigned int candidates = 0;
+
+    while (new[anchor] == blank) {
+      if (++anchor == rows) return 0;
+    }
+
+    for (int row=anchor+1; row<rows; row+=1) {
+      if (old[row] == new[anchor]) {
+        int distance = row - anchor;
+        if (isScrolledBy(old, new, rows, distance)) return distance;
+        if (++candidates == SCROLLBACK_CANDIDATE_LIMIT) break;
+      }
+    }
+  }
+
+  return 0;
+}
+
+static void
+removeScrollbackLine (void) {
+  const ScrollbackLine *line = &scrollbackLines[scrollbackLineStart];
+
+  scrollbackStart = (scrollbackStart + line->length) % scrollbackLimit;
+  scrollbackUsed -= line->length;
+
+  scrollbackLineStart = (scrollbackLineStart + 1) % scrollbackLineLimit;
+  scrollbackLineCount -= 1;
+}
+
+static void
+appendScrollbackLine (const ScreenCharacter *characters, int columns) {
+  unsigned char record[2 + (columns * (2 + UTF8_LEN_MAX))];
+  unsigned char *byte = record;
+  int count = columns;
+
+  while (count && isBlankScrollbackCharacter(&characters[count-1])) count -= 1;
+  *byte++ = count & 0XFF;
+  *byte++ = count >> 8;
+
+  for (int column=0; column<count; ) {
+    unsigned char attributes = characters[column].attributes;
+    int end = column + 1;
+
+    while ((end < count) && (end - column < UINT8_MAX) &&
+           (characters[end].attributes == attributes)) {
+      end += 1;
+    }
+
+    *byte++ = end - column;
+    *byte++ = attributes;
+    column = end;
+  }
+
+  for (int column=0; column<count; column+=1) {
+    Utf8Buffer utf8;
+    size_t length = convertWcharToUtf8(characters[column].text, utf8);
+
+    memcpy(byte, utf8, length);
+    byte += length;
+  }
+
+  {
+    size_t length = byte - record;
+    if (length > scrollbackLimit) return;
+
+    while (scrollbackLineCount &&
+           ((scrollbackLineCount == scrollbackLineLimit) ||
+            (scrollbackUsed + length > scrollbackLimit))) {
+      removeScrollbackLine();
+    }
+
+    {
+      ScrollbackLine *line = &scrollbackLines[(scrollbackLineStart + scrollbackLineCount) % scrollbackLineLimit];
+      size_t offset = (scrollbackStart + scrollbackUsed) % scrollbackLimit;
+      size_t first = MIN(length, scrollbackLimit-offset);
+
+      memcpy(&scrollbackBuffer[offset], record, first);
+      memcpy(scrollbackBuffer, &record[first], length-first);
+
+      line->offset = offset;
+      line->length = length;
+
+      scrollbackUsed += length;
+      scrollbackLineCount += 1;
+    }
+  }
+}
+
+static int
+readScrollbackLine (unsigned int index, int columns, ScreenCharacter *characters) {
+  const ScrollbackLine *line = &scrollbackLines[(scrollbackLineStart + index) % scrollbackLineLimit];
+  unsigned char record[line->length];
+
+  {
+    size_t first = MIN(line->length, scrollbackLimit-line->offset);
+
+    memcpy(record, &scrollbackBuffer[line->offset], first);
+    memcpy(&record[first], scrollbackBuffer, line->length-first);
+  }
+
+  {
+    const unsigned char *byte = record;
+    int count = byte[0] | (byte[1] << 8);
+    byte += 2;
+
+    for (int column=0; column<count; ) {
+      int end = column + *byte++;
+      unsigned char attributes = *byte++;
+
+      while (column < end) {
+        if (column < columns) characters[column].attributes = attributes;
+        column += 1;
+      }
+    }
+
+    {
+      const char *text = (const char *)byte;
+      size_t left = &record[line->length] - byte;
+
+      for (int column=0; column<count; column+=1) {
+        wint_t character = convertUtf8ToWchar(&text, &left);
+
+        if (column < columns) {
+          characters[column].text = (character == WEOF)? WC_C('?'): character;
+        }
+      }
+    }
+
+    while (count < columns) {
+      static const ScreenCharacter blank = {
+        .text = WC_C(' '),
+        .attributes = SCR_COLOUR_DEFAULT
+      };
+
+      characters[count++] = blank;
+    }
+  }
+
+  return 1;
+}
+
+static void
+updateScrollback (void) {
+  ScreenSize size;
+  if (!readScreenSize(&size)) return;
+
+  if ((currentConsoleNumber != scrollbackConsole) || (size.columns != scrollbackColumns)) {
+    resetScrollback();
+    scrollbackConsole = currentConsoleNumber;
+  }
+
+  if (!prepareScrollbackImages(size.columns * size.rows)) {
+    scrollbackRows = 0;
+    return;
+  }
+
+  {
+    unsigned char newIndex = !scrollbackImageIndex;
+    ScreenCharacter *newImage = scrollbackImages[newIndex];
+    uint32_t *newHashes = scrollbackHashes[newIndex];
+
+    for (int row=0; row<size.rows; row+=1) {
+      ScreenCharacter *characters = &newImage[row * size.columns];
+
+      if (!readScreenRow(row, size.columns, characters, NULL)) {
+        scrollbackRows = 0;
+        return;
+      }
+
+      newHashes[row] = hashScrollbackRow(characters, size.columns);
+    }
+
+    if (size.rows == scrollbackRows) {
+      uint32_t blank;
+
+      {
+        ScreenCharacter characters[size.columns];
+
+        for (int column=0; column<size.columns; column+=1) {
+          characters[column].text = WC_C(' ');
+          characters[column].attributes = SCR_COLOUR_DEFAULT;
+        }
+
+        blank = hashScrollbackRow(characters, size.columns);
+      }
+
+      {
+        const ScreenCharacter *oldImage = scrollbackImages[scrollbackImageIndex];
+        const uint32_t *oldHashes = scrollbackHashes[scrollbackImageIndex];
+        int distance = findScrollDistance(oldHashes, newHashes, size.rows, blank);
+
+        for (int row=0; row<distance; row+=1) {
+          /* don't start the scrollback with blank lines */
+          if (!scrollbackLineCount && (oldHashes[row] == blank)) continue;
+          appendScrollbackLine(&oldImage[row * size.columns], size.columns);
+        }
+      }
+    }
+
+    scrollbackImageIndex = newIndex;
+    scrollbackColumns = size.columns;
+    scrollbackRows = size.rows;
+  }
+}
+
+static unsigned int
+getScrollbackOffset (void) {
+  return problemText? 0: scrollbackLineCount;
+}
+
 #ifdef HAVE_LINUX_INPUT_H
 #include <linux/input.h>
 
@@ -1279,6 +1707,23 @@ processParameters_LinuxScreen (char **parameters) {
     }
   }
 
+  scrollbackLimit = 0;
+  {
+    const char *parameter = parameters[PARM_SCROLLBACK];
+
+    if (parameter && *parameter) {
+      int kilobytes = 0;
+      static const int minimum = 0;
+      static const int maximum = 0X10000;
+
+      if (validateInteger(&kilobytes, parameter, &minimum, &maximum)) {
+        scrollbackLimit = kilobytes * 0X400;
+      } else {
+        logMessage(LOG_WARNING, "%s: %s", "invalid scrollback size", parameter);
+      }
+    }
+  }
+
   unicodeEnabled = 1;
   {
     const char *parameter = parameters[PARM_UNICODE];
@@ -1335,6 +1780,10 @@ construct_LinuxScreen (void) {
   inTextMode = 1;
   startTimePeriod(&mappingRecalculationTimer, 4000);
 
+  scrollbackImageIndex = 0;
+  scrollbackConsole = 0;
+  if (!allocateScrollback()) return 0;
+
   brailleDeviceOfflineListener = NULL;
 
 #ifdef HAVE_LINUX_INPUT_H
@@ -1365,6 +1814,7 @@ construct_LinuxScreen (void) {
   closeCurrentConsole();
   closeCurrentScreen();
   closeMainConsole();
+  deallocateScrollback();
   return 0;
 }
 
@@ -1401,6 +1851,7 @@ destruct_LinuxScreen (void) {
   unicodeCacheSize = 0;
   unicodeCacheUsed = 0;
 
+  deallocateScrollback();
   closeMainConsole();
 }
 
@@ -1571,6 +2022,7 @@ refresh_LinuxScreen (void) {
 
     inTextMode = testTextMode();
     screenUpdated = 0;
+    if (scrollbackBuffer && inTextMode) updateScrollback();
 
   done:
     if (problemText) {
@@ -1613,6 +2065,11 @@ describe_LinuxScreen (ScreenDescription *description) {
   if ((description->number = currentConsoleNumber)) {
     if (inTextMode) {
       if (getScreenDescription(description)) {
+        unsigned int offset = getScrollbackOffset();
+
+        description->rows += offset;
+        description->posy += offset;
+        description->scrollback = offset;
       }
     }
   }
@@ -1623,6 +2080,7 @@ describe_LinuxScreen (ScreenDescription *description) {
 
     description->posx = 0;
     description->posy = 0;
+    description->scrollback = 0;
   }
 }
 
@@ -1631,7 +2089,9 @@ readCharacters_LinuxScreen (const ScreenBox *box, ScreenCharacter *buffer) {
   ScreenSize size;
 
   if (readScreenSize(&size)) {
-    if (validateScreenBox(box, size.columns, size.rows)) {
+    unsigned int offset = getScrollbackOffset();
+
+    if (validateScreenBox(box, size.columns, size.rows+offset)) {
       if (problemText) {
         setScreenMessage(box, buffer, problemText);
         return 1;
@@ -1639,7 +2099,13 @@ readCharacters_LinuxScreen (const ScreenBox *box, ScreenCharacter *buffer) {
 
       for (unsigned int row=0; row<box->height; row+=1) {
         ScreenCharacter characters[size.columns];
-        if (!readScreenRow(box->top+row, size.columns, characters, NULL)) return 0;
+        unsigned int line = box->top + row;
+
+        if (line < offset) {
+          readScrollbackLine(line, size.columns, characters);
+        } else if (!readScreenRow(line-offset, size.columns, characters, NULL)) {
+          return 0;
+        }
 
         memcpy(buffer, &characters[box->left],
                (box->width * sizeof(characters[0])));
@@ -2225,6 +2691,17 @@ selectRegion (RegionSelectionArgument *argument) {
 
 static int
 highlightRegion_LinuxScreen (int left, int right, int top, int bottom) {
+  {
+    int offset = getScrollbackOffset();
+
+    if ((bottom -= offset) < 0) return 0;
+
+    if ((top -= offset) < 0) {
+      top = 0;
+      left = 0;
+    }
+  }
+
   RegionSelectionArgument argument = {
     .subcode = TIOCL_SETSEL,
 
@@ -2409,11 +2886,23 @@ handleCommand_LinuxScreen (int command) {
   return 0;
 }
 
+static int (*getPointer_GpmScreen) (int *column, int *row);
+
+static int
+getPointer_LinuxScreen (int *column, int *row) {
+  if (!getPointer_GpmScreen(column, row)) return 0;
+  *row += getScrollbackOffset();
+  return 1;
+}
+
 static void
 scr_initialize (MainScreen *main) {
   initializeRealScreen(main);
   gpmIncludeScreenHandlers(main);
 
+  getPointer_GpmScreen = main->base.getPointer;
+  main->base.getPointer = getPointer_LinuxScreen;
+
   main->base.poll = poll_LinuxScreen;
   main->base.refresh = refresh_LinuxScreen;
   main->base.describe = describe_LinuxScreen;
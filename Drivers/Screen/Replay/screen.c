@@ -0,0 +1,459 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+
+#include "log.h"
+#include "parse.h"
+#include "timing.h"
+#include "bitfield.h"
+#include "async_alarm.h"
+#include "scr_recording.h"
+
+typedef enum {
+  PARM_EXIT,
+  PARM_FILE,
+  PARM_SPEED
+} ScreenParameters;
+#define SCRPARMS "exit", "file", "speed"
+
+#include "scr_driver.h"
+
+static unsigned int exitWhenFinished;
+static const char *recordingPath;
+static int replaySpeed; /* percent - 0 means as fast as possible */
+
+static FILE *recordingStream = NULL;
+static unsigned long int framesReplayed;
+static unsigned char replayFinished;
+
+static ScreenRecordingFrame pendingFrame;
+static unsigned char framePending;
+static unsigned char *frameBody = NULL;
+static size_t frameBodySize = 0;
+
+static uint32_t firstFrameTime;
+static TimeValue replayStart;
+static AsyncHandle frameAlarm = NULL;
+static AsyncHandle exitAlarm = NULL;
+
+static ScreenDescription screenDescription;
+static char *unreadableText = NULL;
+static ScreenCharacter *screenCharacters = NULL;
+static size_t screenSize = 0;
+
+static int
+processParameters_ReplayScreen (char **parameters) {
+  exitWhenFinished = 0;
+  {
+    const char *parameter = parameters[PARM_EXIT];
+
+    if (parameter && *parameter) {
+      if (!validateYesNo(&exitWhenFinished, parameter)) {
+        logMessage(LOG_WARNING, "%s: %s", "invalid exit setting", parameter);
+      }
+    }
+  }
+
+  recordingPath = parameters[PARM_FILE];
+  if (!recordingPath || !*recordingPath) {
+    logMessage(LOG_ERR, "screen recording not specified");
+    return 0;
+  }
+
+  replaySpeed = 100;
+  {
+    const char *parameter = parameters[PARM_SPEED];
+
+    if (parameter && *parameter) {
+      static const int minimum = 0;
+      static const int maximum = 100000;
+
+      if (!validateInteger(&replaySpeed, parameter, &minimum, &maximum)) {
+        logMessage(LOG_WARNING, "%s: %s", "invalid replay speed", parameter);
+      }
+    }
+  }
+
+  return 1;
+}
+
+static int
+readRecording (void *buffer, size_t size) {
+  size_t count = fread(buffer, 1, size, recordingStream);
+
+  if (count == size) return 1;
+
+  if (ferror(recordingStream)) {
+    logMessage(LOG_WARNING, "screen recording read error: %s: %s", recordingPath, strerror(errno));
+  } else if (count) {
+    logMessage(LOG_WARNING, "screen recording truncated: %s", recordingPath);
+  }
+
+  return 0;
+}
+
+static int
+readFrame (void) {
+  framePending = 0;
+  if (!readRecording(&pendingFrame, sizeof(pendingFrame))) return 0;
+
+  {
+    size_t frameSize = getLittleEndian32(pendingFrame.frameSize);
+    size_t bodySize;
+
+    if (frameSize < sizeof(pendingFrame)) {
+      logMessage(LOG_WARNING, "invalid screen recording frame size: %"PRIsize, frameSize);
+      return 0;
+    }
+
+    bodySize = frameSize - sizeof(pendingFrame);
+
+    if (bodySize > frameBodySize) {
+      unsigned char *newBody = realloc(frameBody, bodySize);
+
+      if (!newBody) {
+        logMallocError();
+        return 0;
+      }
+
+      frameBody = newBody;
+      frameBodySize = bodySize;
+    }
+
+    if (!readRecording(frameBody, bodySize)) return 0;
+  }
+
+  framePending = 1;
+  return 1;
+}
+
+static int
+resizeScreen (int columns, int rows) {
+  size_t size = columns * rows;
+
+  if (size > screenSize) {
+    ScreenCharacter *newCharacters = malloc(ARRAY_SIZE(newCharacters, size));
+
+    if (!newCharacters) {
+      logMallocError();
+      return 0;
+    }
+
+    if (screenCharacters) free(screenCharacters);
+    screenCharacters = newCharacters;
+    screenSize = size;
+  }
+
+  memset(screenCharacters, 0, ARRAY_SIZE(screenCharacters, size));
+  screenDescription.cols = columns;
+  screenDescription.rows = rows;
+  return 1;
+}
+
+static int
+applyFrame (void) {
+  const ScreenRecordingFrame *frame = &pendingFrame;
+  const unsigned char *body = frameBody;
+  const unsigned char *end = body + (getLittleEndian32(frame->frameSize) - sizeof(*frame));
+
+  {
+    int columns = getLittleEndian16(frame->columns);
+    int rows = getLittleEndian16(frame->rows);
+
+    if ((columns != screenDescription.cols) || (rows != screenDescription.rows)) {
+      if (!resizeScreen(columns, rows)) return 0;
+    }
+  }
+
+  screenDescription.posx = getLittleEndian16(frame->cursorColumn);
+  screenDescription.posy = getLittleEndian16(frame->cursorRow);
+  screenDescription.number = (int32_t)getLittleEndian32(frame->number);
+  screenDescription.quality = frame->quality;
+  screenDescription.hasCursor = !!(frame->flags & SCREEN_RECORDING_FRAME_HAS_CURSOR);
+  screenDescription.hasSelection = !!(frame->flags & SCREEN_RECORDING_FRAME_HAS_SELECTION);
+
+  {
+    size_t length = getLittleEndian16(frame->unreadableLength);
+
+    if (unreadableText) {
+      free(unreadableText);
+      unreadableText = NULL;
+    }
+
+    if (length) {
+      if (length > (end - body)) goto invalid;
+
+      if (!(unreadableText = malloc(length + 1))) {
+        logMallocError();
+        return 0;
+      }
+
+      memcpy(unreadableText, body, length);
+      unreadableText[length] = 0;
+      body += length;
+    }
+  }
+
+  {
+    uint32_t count = getLittleEndian32(frame->spanCount);
+
+    while (count--) {
+      const ScreenRecordingSpan *span = (const ScreenRecordingSpan *)body;
+      int row, column, length;
+
+      if (sizeof(*span) > (end - body)) goto invalid;
+      body += sizeof(*span);
+
+      row = getLittleEndian16(span->row);
+      column = getLittleEndian16(span->column);
+      length = getLittleEndian16(span->count);
+
+      if (row >= screenDescription.rows) goto invalid;
+      if ((column + length) > screenDescription.cols) goto invalid;
+      if ((length * sizeof(ScreenRecordingCharacter)) > (end - body)) goto invalid;
+
+      {
+        const ScreenRecordingCharacter *from = (const ScreenRecordingCharacter *)body;
+        ScreenCharacter *to = &screenCharacters[(row * screenDescription.cols) + column];
+        const ScreenCharacter *stop = to + length;
+
+        while (to < stop) {
+          to->text = getLittleEndian32(from->text);
+          to->attributes = from->attributes;
+
+          from += 1;
+          to += 1;
+        }
+
+        body = (const unsigned char *)from;
+      }
+    }
+  }
+
+  framesReplayed += 1;
+  return 1;
+
+invalid:
+  logMessage(LOG_WARNING, "invalid screen recording frame: %s", recordingPath);
+  return 0;
+}
+
+static long int
+getFrameDelay (void) {
+  long int delay = getLittleEndian32(pendingFrame.time) - firstFrameTime;
+
+  delay = (delay * 100) / replaySpeed;
+  return delay - getMonotonicElapsed(&replayStart);
+}
+
+static ASYNC_ALARM_CALLBACK(handleExitAlarm) {
+  asyncDiscardHandle(exitAlarm);
+  exitAlarm = NULL;
+
+  raise(SIGTERM);
+}
+
+static void
+finishReplay (void) {
+  if (!replayFinished) {
+    replayFinished = 1;
+    framePending = 0;
+    logMessage(LOG_NOTICE, "screen replay finished: %lu frames", framesReplayed);
+
+    if (exitWhenFinished) {
+      asyncNewRelativeAlarm(&exitAlarm, 0, handleExitAlarm, NULL);
+    }
+  }
+}
+
+static int
+nextFrame (void) {
+  if (applyFrame() && readFrame()) return 1;
+  finishReplay();
+  return 0;
+}
+
+static ASYNC_ALARM_CALLBACK(handleFrameAlarm) {
+  asyncDiscardHandle(frameAlarm);
+  frameAlarm = NULL;
+
+  mainScreenUpdated();
+}
+
+static int
+poll_ReplayScreen (void) {
+  return 0;
+}
+
+static int
+refresh_ReplayScreen (void) {
+  if (framePending) {
+    if (!replaySpeed) {
+      /* one frame per update so that every recorded state is processed */
+      if (nextFrame()) mainScreenUpdated();
+    } else {
+      long int delay;
+
+      while ((delay = getFrameDelay()) <= 0) {
+        if (!nextFrame()) break;
+      }
+
+      if (framePending && !frameAlarm) {
+        asyncNewRelativeAlarm(&frameAlarm, delay, handleFrameAlarm, NULL);
+      }
+    }
+  }
+
+  return 1;
+}
+
+static void
+describe_ReplayScreen (ScreenDescription *description) {
+  if (screenCharacters) {
+    *description = screenDescription;
+    description->unreadable = unreadableText;
+  } else {
+    description->unreadable = "no screen recording";
+  }
+}
+
+static int
+readCharacters_ReplayScreen (const ScreenBox *box, ScreenCharacter *buffer) {
+  if (!screenCharacters) return 0;
+  if (!validateScreenBox(box, screenDescription.cols, screenDescription.rows)) return 0;
+
+  {
+    const ScreenCharacter *from = &screenCharacters[(box->top * screenDescription.cols) + box->left];
+
+    for (int row=0; row<box->height; row+=1) {
+      memcpy(&buffer[row * box->width], from, ARRAY_SIZE(buffer, box->width));
+      from += screenDescription.cols;
+    }
+  }
+
+  return 1;
+}
+
+static int
+openRecording (void) {
+  ScreenRecordingHeader header;
+
+  if (!(recordingStream = fopen(recordingPath, "rb"))) {
+    logMessage(LOG_ERR, "cannot open screen recording: %s: %s", recordingPath, strerror(errno));
+    return 0;
+  }
+
+  if (readRecording(&header, sizeof(header))) {
+    if (memcmp(header.magic, SCREEN_RECORDING_MAGIC, sizeof(header.magic)) != 0) {
+      logMessage(LOG_ERR, "not a screen recording: %s", recordingPath);
+    } else if (getLittleEndian16(header.version) != SCREEN_RECORDING_VERSION) {
+      logMessage(LOG_ERR, "unsupported screen recording version: %s: %u",
+                 recordingPath, getLittleEndian16(header.version));
+    } else {
+      long int skip = getLittleEndian16(header.headerSize) - sizeof(header);
+
+      if ((skip >= 0) && (fseek(recordingStream, skip, SEEK_CUR) != -1)) {
+        if (readFrame()) return 1;
+        logMessage(LOG_ERR, "screen recording has no frames: %s", recordingPath);
+      } else {
+        logMessage(LOG_ERR, "invalid screen recording header: %s", recordingPath);
+      }
+    }
+  }
+
+  fclose(recordingStream);
+  recordingStream = NULL;
+  return 0;
+}
+
+static int
+construct_ReplayScreen (void) {
+  memset(&screenDescription, 0, sizeof(screenDescription));
+  framesReplayed = 0;
+  replayFinished = 0;
+  framePending = 0;
+
+  if (openRecording()) {
+    firstFrameTime = getLittleEndian32(pendingFrame.time);
+    getMonotonicTime(&replayStart);
+
+    if (applyFrame()) {
+      if (!readFrame()) finishReplay();
+      mainScreenUpdated();
+      return 1;
+    }
+
+    fclose(recordingStream);
+    recordingStream = NULL;
+  }
+
+  return 0;
+}
+
+static void
+destruct_ReplayScreen (void) {
+  if (frameAlarm) {
+    asyncCancelRequest(frameAlarm);
+    frameAlarm = NULL;
+  }
+
+  if (exitAlarm) {
+    asyncCancelRequest(exitAlarm);
+    exitAlarm = NULL;
+  }
+
+  if (recordingStream) {
+    fclose(recordingStream);
+    recordingStream = NULL;
+  }
+
+  if (frameBody) {
+    free(frameBody);
+    frameBody = NULL;
+  }
+  frameBodySize = 0;
+
+  if (unreadableText) {
+    free(unreadableText);
+    unreadableText = NULL;
+  }
+
+  if (screenCharacters) {
+    free(screenCharacters);
+    screenCharacters = NULL;
+  }
+  screenSize = 0;
+}
+
+static void
+scr_initialize (MainScreen *main) {
+  initializeRealScreen(main);
+  main->base.poll = poll_ReplayScreen;
+  main->base.refresh = refresh_ReplayScreen;
+  main->base.describe = describe_ReplayScreen;
+  main->base.readCharacters = readCharacters_ReplayScreen;
+  main->processParameters = processParameters_ReplayScreen;
+  main->construct = construct_ReplayScreen;
+  main->destruct = destruct_ReplayScreen;
+}
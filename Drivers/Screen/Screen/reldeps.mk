@@ -0,0 +1,30 @@
+# Dependencies for screen.$O:
+screen.$O: $(SRC_DIR)/screen.c
+screen.$O: $(SRC_TOP)Headers/prologue.h
+screen.$O: $(BLD_TOP)config.h
+screen.$O: $(BLD_TOP)forbuild.h
+screen.$O: $(SRC_TOP)Headers/log.h
+screen.$O: $(SRC_TOP)Headers/strfmt.h
+screen.$O: $(SRC_TOP)Headers/strfmth.h
+screen.$O: $(SRC_TOP)Headers/hostcmd.h
+screen.$O: $(SRC_TOP)Headers/charset.h
+screen.$O: $(SRC_TOP)Headers/lock.h
+screen.$O: $(SRC_TOP)Headers/utf8.h
+screen.$O: $(SRC_TOP)Headers/ascii.h
+screen.$O: $(SRC_TOP)Headers/timing.h
+screen.$O: $(SRC_TOP)Headers/get_thread.h
+screen.$O: $(SRC_TOP)Headers/gettime.h
+screen.$O: $(SRC_TOP)Headers/thread.h
+screen.$O: $(SRC_TOP)Headers/win_pthread.h
+screen.$O: $(SRC_TOP)Headers/async.h
+screen.$O: $(SRC_TOP)Headers/async_event.h
+screen.$O: $(SRC_TOP)Headers/driver.h
+screen.$O: $(SRC_TOP)Headers/ktb_types.h
+screen.$O: $(SRC_TOP)Headers/scr_base.h
+screen.$O: $(SRC_TOP)Headers/scr_driver.h
+screen.$O: $(SRC_TOP)Headers/scr_main.h
+screen.$O: $(SRC_TOP)Headers/scr_real.h
+screen.$O: $(SRC_TOP)Headers/scr_types.h
+screen.$O: $(SRC_TOP)Headers/scr_utils.h
+screen.$O: $(SRC_DIR)/screen.h
+
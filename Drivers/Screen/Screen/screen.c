@@ -43,13 +43,275 @@ static int shmFileDescriptor = -1;
 #include "hostcmd.h"
 #include "charset.h"
 #include "ascii.h"
+#include "timing.h"
+#include "thread.h"
+#include "async_event.h"
 
 #include "scr_driver.h"
 #include "screen.h"
 
+#if defined(HAVE_LINUX_FUTEX_H) && defined(GOT_PTHREADS)
+#define USE_UPDATE_NOTIFIER
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif /* futex */
+
 static unsigned char *shmAddress = NULL;
 static const mode_t shmMode = S_IRWXU;
-static const int shmSize = 4 + ((66 * 132) * 2);
+static size_t shmSize;
+
+/* NULL when the segment has the original layout */
+static const ScreenSegmentHeader *segmentHeader = NULL;
+
+/* what was last copied out of a versioned segment */
+static ScreenSegmentHeader segmentSnapshot;
+static ScreenCharacter *rowCache = NULL;
+static uint32_t *rowGenerations = NULL;
+static uint32_t *copiedGenerations = NULL; /* follows rowGenerations */
+static int segmentProblem = 0;
+
+#ifdef __ATOMIC_ACQUIRE
+#define loadSequence() __atomic_load_n(&segmentHeader->sequence, __ATOMIC_ACQUIRE)
+#define readBarrier() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else /* __ATOMIC_ACQUIRE */
+#define loadSequence() (__sync_synchronize(), *(volatile const uint32_t *)&segmentHeader->sequence)
+#define readBarrier() __sync_synchronize()
+#endif /* __ATOMIC_ACQUIRE */
+
+static void
+discardRowCache (void) {
+  if (rowCache) {
+    free(rowCache);
+    rowCache = NULL;
+  }
+
+  if (rowGenerations) {
+    free(rowGenerations);
+    rowGenerations = NULL;
+    copiedGenerations = NULL;
+  }
+
+  memset(&segmentSnapshot, 0, sizeof(segmentSnapshot));
+}
+
+static int
+checkSegmentLayout (const ScreenSegmentHeader *header) {
+  size_t count = header->columns * header->rows;
+  const char *problem;
+
+  if (header->generationsOffset + (header->rows * sizeof(uint32_t)) > shmSize) {
+    problem = "row generations beyond end of screen image";
+  } else if (header->charactersOffset + (count * sizeof(ScreenSegmentCharacter)) > shmSize) {
+    problem = "characters beyond end of screen image";
+  } else if ((header->generationsOffset | header->charactersOffset) & 3) {
+    problem = "misaligned screen image";
+  } else {
+    segmentProblem = 0;
+    return 1;
+  }
+
+  if (!segmentProblem) {
+    logMessage(LOG_WARNING, "%s: %ux%u", problem, header->columns, header->rows);
+    segmentProblem = 1;
+  }
+
+  return 0;
+}
+
+static int
+resizeRowCache (unsigned int columns, unsigned int rows) {
+  ScreenCharacter *cache = NULL;
+  uint32_t *generations = NULL;
+  size_t count = columns * rows;
+
+  if (count) {
+    if (!(cache = malloc(ARRAY_SIZE(cache, count)))) goto error;
+    if (!(generations = malloc(ARRAY_SIZE(generations, rows*2)))) goto error;
+
+    /* sequences are even, so this forces every row to be copied */
+    for (unsigned int row=0; row<rows; row+=1) generations[row] = 1;
+  }
+
+  discardRowCache();
+  rowCache = cache;
+  rowGenerations = generations;
+  copiedGenerations = generations? &generations[rows]: NULL;
+  segmentSnapshot.columns = columns;
+  segmentSnapshot.rows = rows;
+  return 1;
+
+error:
+  logMallocError();
+  if (cache) free(cache);
+  return 0;
+}
+
+static void
+copySegmentRow (const ScreenSegmentHeader *header, unsigned int row) {
+  const ScreenSegmentCharacter *from = (const void *)&shmAddress[header->charactersOffset];
+  ScreenCharacter *to = &rowCache[row * segmentSnapshot.columns];
+  const ScreenSegmentCharacter *end;
+
+  from += row * segmentSnapshot.columns;
+  end = from + segmentSnapshot.columns;
+
+  while (from < end) {
+    to->text = from->text;
+    to->attributes = from->attributes;
+    from += 1, to += 1;
+  }
+}
+
+/* Bring the row cache up to date, copying only the rows whose generation
+ * has changed. A copy which raced with the producer is retried. The new
+ * generations are only committed once the copy is known to be consistent,
+ * so a row copied during a lost race keeps its old generation and is copied
+ * again once the producer is done with it.
+ */
+static int
+refreshSegment (void) {
+  int attempts = 0;
+
+  while (attempts++ < 10) {
+    uint32_t sequence = loadSequence();
+
+    if (sequence & 1) {
+      continue;
+    }
+
+    if (rowCache && (sequence == segmentSnapshot.sequence)) return 1;
+
+    {
+      ScreenSegmentHeader header = *segmentHeader;
+      const uint32_t *generations = (const void *)&shmAddress[header.generationsOffset];
+
+      if (!checkSegmentLayout(&header)) return 0;
+
+      if ((header.columns != segmentSnapshot.columns) || (header.rows != segmentSnapshot.rows) || !rowCache) {
+        if (!resizeRowCache(header.columns, header.rows)) return 0;
+      }
+
+      for (unsigned int row=0; row<header.rows; row+=1) {
+        uint32_t generation = generations[row];
+
+        if (generation != rowGenerations[row]) copySegmentRow(&header, row);
+        copiedGenerations[row] = generation;
+      }
+
+      readBarrier();
+      if (loadSequence() != sequence) continue;
+
+      memcpy(rowGenerations, copiedGenerations, ARRAY_SIZE(rowGenerations, header.rows));
+
+      segmentSnapshot.sequence = sequence;
+      segmentSnapshot.cursorColumn = header.cursorColumn;
+      segmentSnapshot.cursorRow = header.cursorRow;
+      segmentSnapshot.window = header.window;
+      segmentSnapshot.windowFlags = header.windowFlags;
+      return 1;
+    }
+  }
+
+  /* keep what we have - the next update will try again */
+  return 1;
+}
+
+#ifdef USE_UPDATE_NOTIFIER
+#define UPDATE_NOTIFIER_TIMEOUT 500 /* milliseconds - to check for stop */
+
+static pthread_t updateNotifierThread;
+static AsyncEvent *updateEvent = NULL;
+static volatile int updateNotifierStop;
+static int updateNotifierRunning = 0;
+
+ASYNC_EVENT_CALLBACK(handleScreenUpdated) {
+  mainScreenUpdated();
+}
+
+static THREAD_FUNCTION(runUpdateNotifier) {
+  uint32_t sequence = loadSequence();
+
+  while (!updateNotifierStop) {
+    struct timespec timeout = {
+      .tv_sec = 0,
+      .tv_nsec = UPDATE_NOTIFIER_TIMEOUT * NSECS_PER_MSEC
+    };
+
+    /* returns immediately if the sequence has already changed */
+    syscall(SYS_futex, &segmentHeader->sequence, FUTEX_WAIT, sequence, &timeout, NULL, 0);
+
+    {
+      uint32_t current = loadSequence();
+
+      if (current != sequence) {
+        sequence = current;
+        if (!(sequence & 1)) asyncSignalEvent(updateEvent, NULL);
+      }
+    }
+  }
+
+  return NULL;
+}
+
+static void
+startUpdateNotifier (void) {
+  if ((updateEvent = asyncNewEvent(handleScreenUpdated, NULL))) {
+    updateNotifierStop = 0;
+
+    if (!createThread("driver-screen-Screen", &updateNotifierThread, NULL,
+                      runUpdateNotifier, NULL)) {
+      updateNotifierRunning = 1;
+      return;
+    }
+
+    asyncDiscardEvent(updateEvent);
+    updateEvent = NULL;
+  }
+}
+
+static void
+stopUpdateNotifier (void) {
+  if (updateNotifierRunning) {
+    updateNotifierStop = 1;
+    pthread_join(updateNotifierThread, NULL);
+    updateNotifierRunning = 0;
+
+    asyncDiscardEvent(updateEvent);
+    updateEvent = NULL;
+  }
+}
+#endif /* USE_UPDATE_NOTIFIER */
+
+static int
+prepareSegment (void) {
+  const ScreenSegmentHeader *header = (const void *)shmAddress;
+
+  if ((shmSize >= sizeof(*header)) && (header->magic == SCREEN_SEGMENT_MAGIC)) {
+    if ((header->version < SCREEN_SEGMENT_VERSION) || (header->headerSize < sizeof(*header))) {
+      logMessage(LOG_ERR, "unsupported screen image version: %u", header->version);
+      return 0;
+    }
+
+    segmentHeader = header;
+    segmentProblem = 0;
+    discardRowCache();
+    logMessage(LOG_INFO, "Screen image version: %u", header->version);
+
+#ifdef USE_UPDATE_NOTIFIER
+    if (header->segmentFlags & SCREEN_SEGMENT_FLAG_FUTEX) startUpdateNotifier();
+#endif /* USE_UPDATE_NOTIFIER */
+
+    return 1;
+  }
+
+  if (shmSize < SCREEN_SEGMENT_LEGACY_SIZE) {
+    logMessage(LOG_ERR, "screen image too small: %zu", shmSize);
+    return 0;
+  }
+
+  segmentHeader = NULL;
+  return 1;
+}
 
 static int
 construct_ScreenScreen (void) {
@@ -78,10 +340,20 @@ construct_ScreenScreen (void) {
     while (keyCount > 0) {
       shmKey = keys[--keyCount];
       logMessage(LOG_DEBUG, "Trying shared memory key: 0X%" PRIkey, shmKey);
-      if ((shmIdentifier = shmget(shmKey, shmSize, shmMode)) != -1) {
+      if ((shmIdentifier = shmget(shmKey, 0, shmMode)) != -1) {
         if ((shmAddress = shmat(shmIdentifier, NULL, 0)) != (unsigned char *)-1) {
-          logMessage(LOG_INFO, "Screen image shared memory key: 0X%" PRIkey, shmKey);
-          return 1;
+          struct shmid_ds status;
+
+          if (shmctl(shmIdentifier, IPC_STAT, &status) != -1) {
+            shmSize = status.shm_segsz;
+            logMessage(LOG_INFO, "Screen image shared memory key: 0X%" PRIkey, shmKey);
+            if (prepareSegment()) return 1;
+          } else {
+            logSystemError("shmctl[IPC_STAT]");
+          }
+
+          shmdt(shmAddress);
+          shmAddress = NULL;
         } else {
           logMessage(LOG_WARNING, "Cannot attach shared memory segment 0X%" PRIkey ": %s",
                      shmKey, strerror(errno));
@@ -98,10 +370,21 @@ construct_ScreenScreen (void) {
 #ifdef HAVE_SHM_OPEN
   {
     if ((shmFileDescriptor = shm_open(shmPath, O_RDONLY, shmMode)) != -1) {
-      if ((shmAddress = mmap(0, shmSize, PROT_READ, MAP_SHARED, shmFileDescriptor, 0)) != MAP_FAILED) {
-        return 1;
+      struct stat status;
+
+      if (fstat(shmFileDescriptor, &status) != -1) {
+        shmSize = status.st_size;
+
+        if ((shmAddress = mmap(0, shmSize, PROT_READ, MAP_SHARED, shmFileDescriptor, 0)) != MAP_FAILED) {
+          if (prepareSegment()) return 1;
+          munmap(shmAddress, shmSize);
+        } else {
+          logSystemError("mmap");
+        }
+
+        shmAddress = NULL;
       } else {
-        logSystemError("mmap");
+        logSystemError("fstat");
       }
 
       close(shmFileDescriptor);
@@ -122,9 +405,16 @@ getAuxiliaryData (void) {
 
 static int
 currentVirtualTerminal_ScreenScreen (void) {
+  if (segmentHeader) return segmentSnapshot.window;
   return getAuxiliaryData()[0];
 }
 
+static int
+getWindowFlags (void) {
+  if (segmentHeader) return segmentSnapshot.windowFlags;
+  return getAuxiliaryData()[1];
+}
+
 static int
 doScreenCommand (const char *command, ...) {
   va_list args;
@@ -168,8 +458,41 @@ userVirtualTerminal_ScreenScreen (int number) {
   return 1 + number;
 }
 
+static int
+poll_ScreenScreen (void) {
+#ifdef USE_UPDATE_NOTIFIER
+  if (updateNotifierRunning) return 0;
+#endif /* USE_UPDATE_NOTIFIER */
+
+  return 1;
+}
+
+static int
+refresh_ScreenScreen (void) {
+  if (segmentHeader) return refreshSegment();
+  return 1;
+}
+
 static void
 describe_ScreenScreen (ScreenDescription *description) {
+  if (segmentHeader) {
+    if (!rowCache) refreshSegment();
+
+    if (!rowCache) {
+      description->unreadable = "screen image not readable";
+      description->cols = description->rows = 1;
+      description->posx = description->posy = 0;
+    } else {
+      description->cols = segmentSnapshot.columns;
+      description->rows = segmentSnapshot.rows;
+      description->posx = segmentSnapshot.cursorColumn;
+      description->posy = segmentSnapshot.cursorRow;
+    }
+
+    description->number = currentVirtualTerminal_ScreenScreen();
+    return;
+  }
+
   description->cols = shmAddress[0];
   description->rows = shmAddress[1];
   description->posx = shmAddress[2];
@@ -182,6 +505,17 @@ readCharacters_ScreenScreen (const ScreenBox *box, ScreenCharacter *buffer) {
   ScreenDescription description;                 /* screen statistics */
   describe_ScreenScreen(&description);
   if (validateScreenBox(box, description.cols, description.rows)) {
+    if (segmentHeader) {
+      const ScreenCharacter *from = &rowCache[(box->top * segmentSnapshot.columns) + box->left];
+
+      for (int row=0; row<box->height; row+=1) {
+        memcpy(&buffer[row * box->width], from, ARRAY_SIZE(buffer, box->width));
+        from += segmentSnapshot.columns;
+      }
+
+      return 1;
+    }
+
     ScreenCharacter *character = buffer;
     unsigned char *text = shmAddress + 4 + (box->top * description.cols) + box->left;
     unsigned char *attributes = text + (description.cols * description.rows);
@@ -213,10 +547,10 @@ insertKey_ScreenScreen (ScreenKey key) {
   wchar_t character = key & SCR_KEY_CHAR_MASK;
 
   if (isSpecialKey(key)) {
-    const unsigned char flags = getAuxiliaryData()[1];
+    const unsigned char flags = getWindowFlags();
 
 #define KEY(key,string) case (key): sequence = (string); break
-#define CURSOR_KEY(key,string1,string2) KEY((key), ((flags & 0X01)? (string1): (string2)))
+#define CURSOR_KEY(key,string1,string2) KEY((key), ((flags & SCREEN_WINDOW_CURSOR_KEYS_APPLICATION)? (string1): (string2)))
 
     switch (character) {
       KEY(SCR_KEY_ENTER, "\r");
@@ -303,6 +637,13 @@ previousVirtualTerminal_ScreenScreen (void) {
 
 static void
 destruct_ScreenScreen (void) {
+#ifdef USE_UPDATE_NOTIFIER
+  stopUpdateNotifier();
+#endif /* USE_UPDATE_NOTIFIER */
+
+  discardRowCache();
+  segmentHeader = NULL;
+
 #ifdef HAVE_SHMGET
   if (shmIdentifier != -1) {
     shmdt(shmAddress);
@@ -324,6 +665,8 @@ static void
 scr_initialize (MainScreen *main) {
   initializeRealScreen(main);
   main->base.currentVirtualTerminal = currentVirtualTerminal_ScreenScreen;
+  main->base.poll = poll_ScreenScreen;
+  main->base.refresh = refresh_ScreenScreen;
   main->base.describe = describe_ScreenScreen;
   main->base.readCharacters = readCharacters_ScreenScreen;
   main->base.insertKey = insertKey_ScreenScreen;
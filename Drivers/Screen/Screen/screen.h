@@ -23,6 +23,71 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include <stdint.h>
+
+/* The original layout (still supported) is:
+ *   columns, rows, cursor column, cursor row (one byte each)
+ *   text (one byte per character, in the local character set)
+ *   attributes (one byte per character)
+ *   window number, flags (one byte each)
+ * and the segment is at least 4 + (66 * 132 * 2) bytes long.
+ *
+ * The versioned layout begins with the header below. All offsets are from
+ * the start of the segment, and all fields are in host byte order.
+ *
+ * While writing, the producer makes the sequence odd, and then makes it even
+ * again when done, so a reader copies what it needs and discards the copy if
+ * the sequence was odd or has changed meanwhile. Each row has a generation
+ * number which is set to the new (even) sequence whenever that row changes.
+ * If SCREEN_SEGMENT_FLAG_FUTEX is set, the producer also wakes all futex
+ * waiters on the sequence after each update.
+ *
+ * The magic number can't be mistaken for the original layout since its second
+ * byte would mean more rows than the original 66 - 82 when little-endian, and
+ * 76 when big-endian.
+ */
+
+#define SCREEN_SEGMENT_MAGIC 0X544C5242 /* "BRLT" when little-endian */
+#define SCREEN_SEGMENT_VERSION 2
+
+#define SCREEN_SEGMENT_LEGACY_COLUMNS 132
+#define SCREEN_SEGMENT_LEGACY_ROWS 66
+#define SCREEN_SEGMENT_LEGACY_SIZE (4 + ((SCREEN_SEGMENT_LEGACY_ROWS * SCREEN_SEGMENT_LEGACY_COLUMNS) * 2))
+
+typedef enum {
+  SCREEN_SEGMENT_FLAG_FUTEX = 0X01
+} ScreenSegmentFlag;
+
+typedef enum {
+  SCREEN_WINDOW_CURSOR_KEYS_APPLICATION = 0X01
+} ScreenWindowFlag;
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t headerSize;
+  uint32_t segmentSize;
+  uint32_t segmentFlags;
+
+  uint32_t sequence;
+  uint32_t reserved;
+
+  uint16_t columns;
+  uint16_t rows;
+  uint16_t cursorColumn;
+  uint16_t cursorRow;
+  uint16_t window;
+  uint16_t windowFlags;
+
+  uint32_t generationsOffset; /* uint32_t per row */
+  uint32_t charactersOffset; /* ScreenSegmentCharacter per column per row */
+} ScreenSegmentHeader;
+
+typedef struct {
+  uint32_t text; /* a UTF-32 code point */
+  uint32_t attributes; /* the VGA attributes (see ScreenAttributes) */
+} ScreenSegmentCharacter;
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,32 @@
+# Dependencies for speech.$O:
+speech.$O: $(SRC_DIR)/speech.c
+speech.$O: $(SRC_TOP)Headers/prologue.h
+speech.$O: $(BLD_TOP)config.h
+speech.$O: $(BLD_TOP)forbuild.h
+speech.$O: $(SRC_TOP)Headers/log.h
+speech.$O: $(SRC_TOP)Headers/timing.h
+speech.$O: $(SRC_TOP)Headers/async.h
+speech.$O: $(SRC_TOP)Headers/async_io.h
+speech.$O: $(SRC_TOP)Headers/driver.h
+speech.$O: $(SRC_TOP)Headers/spk.h
+speech.$O: $(SRC_TOP)Headers/spk_base.h
+speech.$O: $(SRC_TOP)Headers/spk_driver.h
+speech.$O: $(SRC_TOP)Headers/spk_types.h
+speech.$O: $(SRC_DIR)/speech.h
+
+# Dependencies for xshelper.$O:
+xshelper.$O: $(SRC_DIR)/xshelper.c
+xshelper.$O: $(SRC_TOP)Headers/prologue.h
+xshelper.$O: $(BLD_TOP)config.h
+xshelper.$O: $(BLD_TOP)forbuild.h
+xshelper.$O: $(SRC_TOP)Headers/pid.h
+xshelper.$O: $(SRC_TOP)Headers/program.h
+xshelper.$O: $(SRC_TOP)Headers/datafile.h
+xshelper.$O: $(SRC_TOP)Headers/options.h
+xshelper.$O: $(SRC_TOP)Headers/strfmth.h
+xshelper.$O: $(SRC_TOP)Headers/variables.h
+xshelper.$O: $(SRC_TOP)Headers/log.h
+xshelper.$O: $(SRC_TOP)Headers/parse.h
+xshelper.$O: $(SRC_TOP)Headers/timing.h
+xshelper.$O: $(SRC_DIR)/speech.h
+
@@ -47,7 +47,15 @@ typedef enum {
 #include "speech.h"
 
 static int helper_fd = -1;
-static uint16_t totalCharacterCount;
+
+/* The helper speaks the texts it's given in order, and reports the end of
+ * each one separately, so the character counts of those which haven't
+ * finished yet are needed to tell a location from the end of a text.
+ */
+#define TEXT_COUNT_QUEUE_SIZE 0X40
+static uint16_t textCountQueue[TEXT_COUNT_QUEUE_SIZE];
+static unsigned int textCountStart;
+static unsigned int textCountCount;
 
 #define TRACK_DATA_SIZE 2
 static AsyncHandle trackHandle = NULL;
@@ -125,7 +133,12 @@ static void spk_say(volatile SpeechSynthesizer *spk, const unsigned char *text,
   mywrite(spk, helper_fd, l, 5);
   mywrite(spk, helper_fd, text, length);
   if (attributes) mywrite(spk, helper_fd, attributes, count);
-  totalCharacterCount = count;
+
+  if (textCountCount == TEXT_COUNT_QUEUE_SIZE) {
+    textCountStart = (textCountStart + 1) % TEXT_COUNT_QUEUE_SIZE;
+    textCountCount -= 1;
+  }
+  textCountQueue[(textCountStart + textCountCount++) % TEXT_COUNT_QUEUE_SIZE] = count;
 }
 
 static void spk_mute (volatile SpeechSynthesizer *spk)
@@ -134,6 +147,7 @@ static void spk_mute (volatile SpeechSynthesizer *spk)
   if(helper_fd < 0) return;
   logMessage(LOG_DEBUG,"mute");
   mywrite(spk, helper_fd, &c,1);
+  textCountCount = 0;
 }
 
 static void spk_setRate (volatile SpeechSynthesizer *spk, unsigned char setting)
@@ -163,9 +177,14 @@ ASYNC_INPUT_CALLBACK(xsHandleSpeechTrackingInput) {
     const unsigned char *buffer = parameters->buffer;
     uint16_t location = (buffer[0] << 8) | buffer[1];
 
-    if (location < totalCharacterCount) {
+    if (textCountCount && (location < textCountQueue[textCountStart])) {
       tellSpeechLocation(spk, location);
     } else {
+      if (textCountCount) {
+        textCountStart = (textCountStart + 1) % TEXT_COUNT_QUEUE_SIZE;
+        textCountCount -= 1;
+      }
+
       tellSpeechFinished(spk);
     }
 
@@ -180,6 +199,8 @@ static int spk_construct (volatile SpeechSynthesizer *spk, char **parameters)
   const char *extSockPath = parameters[PARM_SOCK_PATH];
 
   spk->setRate = spk_setRate;
+  textCountStart = 0;
+  textCountCount = 0;
 
   if(!*extSockPath) extSockPath = HELPER_SOCKET_PATH;
 
@@ -0,0 +1,357 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* xshelper.c - A stand-in synthesizer for the ExternalSpeech driver.
+ *
+ * Nothing is actually spoken. Each text is rendered in its entirety (taking
+ * the render time for each of its characters) before it can start being
+ * spoken, and is then spoken at the speak time for each character. Texts are
+ * rendered and spoken in the order they arrive, and rendering overlaps the
+ * speaking of earlier texts. The location of each spoken character is
+ * reported back, which is what spktest -l uses to measure how long a text
+ * takes to start being spoken.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "program.h"
+#include "options.h"
+#include "log.h"
+#include "parse.h"
+#include "timing.h"
+#include "speech.h"
+
+static char *opt_renderTime;
+static char *opt_speakTime;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .letter = 'r',
+    .word = "render-time",
+    .argument = "microseconds",
+    .setting.string = &opt_renderTime,
+    .internal.setting = "500",
+    .description = "How long each character takes to be rendered."
+  },
+
+  { .letter = 's',
+    .word = "speak-time",
+    .argument = "milliseconds",
+    .setting.string = &opt_speakTime,
+    .internal.setting = "2",
+    .description = "How long each character takes to be spoken."
+  },
+END_OPTION_TABLE
+
+#define TEXT_QUEUE_SIZE 0X100
+#define LOCATION_FINISHED 0XFFFF
+
+typedef struct {
+  unsigned int count;
+  TimeValue rendered;
+} QueuedText;
+
+static int renderTime;
+static int speakTime;
+
+static QueuedText textQueue[TEXT_QUEUE_SIZE];
+static unsigned int textQueueStart = 0;
+static unsigned int textQueueCount = 0;
+static TimeValue rendererFree;
+
+static int speakingText = 0;
+static unsigned int speakingLocation;
+static TimeValue nextLocation;
+
+static unsigned char inputBuffer[0X10000 + 5 + 0X10000];
+static size_t inputLength = 0;
+
+static void
+addMicroseconds (TimeValue *time, long int microseconds) {
+  time->seconds += microseconds / USECS_PER_SEC;
+  time->nanoseconds += (microseconds % USECS_PER_SEC) * NSECS_PER_USEC;
+  normalizeTimeValue(time);
+}
+
+static unsigned int
+countCharacters (const unsigned char *text, size_t length) {
+  unsigned int count = 0;
+
+  while (length--) {
+    if ((*text++ & 0XC0) != 0X80) count += 1;
+  }
+
+  return count;
+}
+
+static int
+writeLocation (int socket, unsigned int location) {
+  unsigned char bytes[] = {location >> 8, location & 0XFF};
+
+  if (write(socket, bytes, sizeof(bytes)) == -1) {
+    logSystemError("write");
+    return 0;
+  }
+
+  return 1;
+}
+
+static void
+queueText (unsigned int count) {
+  if (textQueueCount == TEXT_QUEUE_SIZE) {
+    logMessage(LOG_WARNING, "text queue full");
+    return;
+  }
+
+  {
+    QueuedText *text = &textQueue[(textQueueStart + textQueueCount++) % TEXT_QUEUE_SIZE];
+    TimeValue now;
+
+    getMonotonicTime(&now);
+    if (compareTimeValues(&rendererFree, &now) < 0) rendererFree = now;
+    addMicroseconds(&rendererFree, (long int)renderTime * count);
+
+    text->count = count;
+    text->rendered = rendererFree;
+  }
+}
+
+static void
+muteSpeech (void) {
+  textQueueCount = 0;
+  speakingText = 0;
+  getMonotonicTime(&rendererFree);
+}
+
+static int
+speakText (int socket) {
+  TimeValue now;
+
+  getMonotonicTime(&now);
+
+  while (textQueueCount) {
+    QueuedText *text = &textQueue[textQueueStart];
+
+    if (!speakingText) {
+      if (compareTimeValues(&now, &text->rendered) < 0) break;
+
+      speakingText = 1;
+      speakingLocation = 0;
+      nextLocation = now;
+    }
+
+    if (compareTimeValues(&now, &nextLocation) < 0) break;
+
+    if (speakingLocation < text->count) {
+      if (!writeLocation(socket, speakingLocation)) return 0;
+      speakingLocation += 1;
+      adjustTimeValue(&nextLocation, speakTime);
+    } else {
+      if (!writeLocation(socket, LOCATION_FINISHED)) return 0;
+      speakingText = 0;
+      textQueueStart = (textQueueStart + 1) % TEXT_QUEUE_SIZE;
+      textQueueCount -= 1;
+    }
+  }
+
+  return 1;
+}
+
+static int
+getPollTimeout (void) {
+  if (textQueueCount) {
+    const TimeValue *time = speakingText? &nextLocation: &textQueue[textQueueStart].rendered;
+    TimeValue now;
+    long int milliseconds;
+
+    getMonotonicTime(&now);
+    milliseconds = millisecondsBetween(&now, time);
+    return (milliseconds < 0)? 0: (milliseconds + 1);
+  }
+
+  return -1;
+}
+
+static size_t
+processCommand (const unsigned char *bytes, size_t count) {
+  switch (bytes[0]) {
+    case 1: /* mute */
+      muteSpeech();
+      return 1;
+
+    case 3: /* time scale */
+      return (count < 5)? 0: 5;
+
+    case 4: { /* say */
+      if (count < 5) return 0;
+
+      {
+        size_t length = (bytes[1] << 8) | bytes[2];
+        size_t attributes = (bytes[3] << 8) | bytes[4];
+        size_t size = 5 + length + attributes;
+
+        if (count < size) return 0;
+        queueText(attributes? attributes: countCharacters(&bytes[5], length));
+        return size;
+      }
+    }
+
+    default:
+      logMessage(LOG_ERR, "unknown command: %u", bytes[0]);
+      return count;
+  }
+}
+
+static int
+readCommands (int socket) {
+  ssize_t count = read(socket, &inputBuffer[inputLength], sizeof(inputBuffer)-inputLength);
+
+  if (count == -1) {
+    if (errno == EINTR) return 1;
+    logSystemError("read");
+    return 0;
+  }
+
+  if (!count) return 0;
+  inputLength += count;
+
+  {
+    size_t offset = 0;
+    size_t size;
+
+    while ((offset < inputLength) &&
+           (size = processCommand(&inputBuffer[offset], inputLength-offset))) {
+      offset += size;
+    }
+
+    memmove(inputBuffer, &inputBuffer[offset], inputLength-offset);
+    inputLength -= offset;
+  }
+
+  return 1;
+}
+
+static int
+acceptConnection (const char *path) {
+  int listener;
+
+  if ((listener = socket(PF_UNIX, SOCK_STREAM, 0)) != -1) {
+    struct sockaddr_un address;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path)-1);
+    unlink(path);
+
+    if (bind(listener, (struct sockaddr *)&address, sizeof(address)) != -1) {
+      if (listen(listener, 1) != -1) {
+        int connection;
+
+        logMessage(LOG_NOTICE, "listening on %s", path);
+
+        if ((connection = accept(listener, NULL, NULL)) != -1) {
+          close(listener);
+          unlink(path);
+          return connection;
+        } else {
+          logSystemError("accept");
+        }
+      } else {
+        logSystemError("listen");
+      }
+
+      unlink(path);
+    } else {
+      logSystemError("bind");
+    }
+
+    close(listener);
+  } else {
+    logSystemError("socket");
+  }
+
+  return -1;
+}
+
+int
+main (int argc, char *argv[]) {
+  const char *path = HELPER_SOCKET_PATH;
+  int connection;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "xshelper",
+      .argumentsSummary = "[socket-path]"
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  {
+    static const int minimum = 0;
+
+    if (!validateInteger(&renderTime, opt_renderTime, &minimum, NULL)) {
+      logMessage(LOG_ERR, "%s: %s", "invalid render time", opt_renderTime);
+      return PROG_EXIT_SYNTAX;
+    }
+
+    if (!validateInteger(&speakTime, opt_speakTime, &minimum, NULL)) {
+      logMessage(LOG_ERR, "%s: %s", "invalid speak time", opt_speakTime);
+      return PROG_EXIT_SYNTAX;
+    }
+  }
+
+  if (argc) path = *argv++, --argc;
+
+  if (argc) {
+    logMessage(LOG_ERR, "too many parameters");
+    return PROG_EXIT_SYNTAX;
+  }
+
+  if ((connection = acceptConnection(path)) == -1) return PROG_EXIT_FATAL;
+  getMonotonicTime(&rendererFree);
+
+  while (1) {
+    struct pollfd descriptor = {
+      .fd = connection,
+      .events = POLLIN
+    };
+
+    int result = poll(&descriptor, 1, getPollTimeout());
+
+    if (result == -1) {
+      if (errno == EINTR) continue;
+      logSystemError("poll");
+      break;
+    }
+
+    if (result && !readCommands(connection)) break;
+    if (!speakText(connection)) break;
+  }
+
+  close(connection);
+  return PROG_EXIT_SUCCESS;
+}
@@ -261,6 +261,9 @@ typedef enum {
   BRL_CMD_GUI_ITEM_NEXT /* move to the next item in the screen area */,
   BRL_CMD_GUI_ITEM_LAST /* move to the last item in the screen area */,
 
+  BRL_CMD_FREEZE_PREV /* freeze the screen or go back to the previous screen image */,
+  BRL_CMD_FREEZE_NEXT /* go forward to the next frozen screen image */,
+
   BRL_basicCommandCount /* must be last */
 } BRL_BasicCommand;
 
@@ -52,9 +52,11 @@ extern "C" {
 
 #define JAVA_OBJ_LANG(name) "java/lang/" name
 #define JAVA_OBJ_IO(name) "java/io/" name
+#define JAVA_OBJ_NIO(name) "java/nio/" name
 #define JAVA_OBJ_UTIL(name) "java/util/" name
 #define JAVA_OBJ_CONCURRENT(name) JAVA_OBJ_UTIL("concurrent/" name)
 
+#define JAVA_OBJ_BYTE_BUFFER JAVA_OBJ_NIO("ByteBuffer")
 #define JAVA_OBJ_CHAR_SEQUENCE JAVA_OBJ_LANG("CharSequence")
 #define JAVA_OBJ_CLASS JAVA_OBJ_LANG("Class")
 #define JAVA_OBJ_EOF_EXCEPTION JAVA_OBJ_IO("EOFException")
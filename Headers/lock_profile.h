@@ -0,0 +1,49 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_LOCK_PROFILE
+#define BRLTTY_INCLUDED_LOCK_PROFILE
+
+#include "log.h"
+#include "timing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define LOCK_PROFILE_REPORT_INTERVAL (SECS_PER_MIN * MSECS_PER_SEC)
+
+static inline int
+isLockProfilingEnabled (void) {
+  return !!LOG_CATEGORY_FLAG(LOCK_PROFILE);
+}
+
+extern void recordLockAcquisition (void *lock, const char *name, const TimeValue *waitStart, int exclusive);
+extern void recordLockRelease (void *lock);
+
+extern void beginLockProfile (void);
+extern void resetLockHoldState (void);
+
+extern void logLockProfile (unsigned int count);
+extern void resetLockProfile (void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_LOCK_PROFILE */
@@ -33,6 +33,7 @@ extern "C" {
 
 extern unsigned char systemLogLevel;
 extern unsigned char stderrLogLevel;
+extern unsigned char syncLogLevel;
 
 #ifndef LOG_INFO
 typedef enum {
@@ -70,6 +71,8 @@ typedef enum {
   LOG_CATEGORY_INDEX(UPDATE_EVENTS),
   LOG_CATEGORY_INDEX(SPEECH_EVENTS),
   LOG_CATEGORY_INDEX(ASYNC_EVENTS),
+  LOG_CATEGORY_INDEX(ASYNC_PROFILE),
+  LOG_CATEGORY_INDEX(LOCK_PROFILE),
   LOG_CATEGORY_INDEX(SERVER_EVENTS),
 
   LOG_CATEGORY_INDEX(SERIAL_IO),
@@ -97,6 +100,7 @@ extern unsigned char logCategoryFlags[LOG_CATEGORY_COUNT];
 
 extern void openLogFile (const char *path);
 extern void closeLogFile (void);
+extern void resumeLogWriter (void);
 
 extern void openSystemLog (void);
 extern void closeSystemLog (void);
@@ -217,6 +217,10 @@ typedef struct {
   unsigned char cursorTrackingDelay;
   unsigned char trackScreenScroll;
 
+  unsigned char caseSensitiveSearch;
+  unsigned char regularExpressionSearch;
+  unsigned char screenHistory;
+
   unsigned char saveOnExit;
   unsigned char showSubmenuSizes;
   unsigned char showAdvancedSubmenus;
@@ -68,6 +68,18 @@ extern Element *findElementWithItem (const Queue *queue, void *item);
 typedef int ItemProcessor (void *item, void *data);
 extern Element *processQueue (Queue *queue, ItemProcessor *processItem, void *data);
 
+typedef struct {
+  unsigned long int slabAllocations;
+  unsigned long int elementsAllocated;
+  unsigned long int elementsPooled;
+  unsigned long int elementsTaken;
+  unsigned long int elementsReturned;
+  unsigned long int lockAcquisitions;
+  unsigned long int lockContentions;
+} QueueStatistics;
+
+extern void getQueueStatistics (QueueStatistics *statistics);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -41,6 +41,7 @@ typedef struct {
     void *internal;
     const wchar_t *characters;
     size_t length;
+    size_t offset;
   } text;
 
   struct {
@@ -81,6 +82,16 @@ extern RGX_Matcher *rgxMatchTextCharacters (
   RGX_Match **result, void *data
 );
 
+/* Matching starts at the offset, but the characters before it are still
+ * seen by anchors, word boundaries, and look-behind assertions. Capture
+ * bounds are relative to the start of the characters.
+ */
+extern RGX_Matcher *rgxMatchTextCharactersFrom (
+  RGX_Object *rgx,
+  const wchar_t *characters, size_t length, size_t offset,
+  RGX_Match **result, void *data
+);
+
 extern RGX_Matcher *rgxMatchTextString (
   RGX_Object *rgx,
   const wchar_t *string,
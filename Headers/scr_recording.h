@@ -0,0 +1,83 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_SCR_RECORDING
+#define BRLTTY_INCLUDED_SCR_RECORDING
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* A screen recording (written by scrrec, played back by the Replay screen
+ * driver) is a header followed by a sequence of frames. All multibyte fields
+ * are little endian.
+ *
+ * Each frame is a ScreenRecordingFrame, the unreadable text (if any), and
+ * then its spans. A span is a ScreenRecordingSpan followed by that many
+ * ScreenRecordingCharacter entries. A frame only contains the characters
+ * which have changed since the previous frame. When the screen size changes,
+ * the previous content is taken to be all zeroes.
+ */
+
+#define SCREEN_RECORDING_MAGIC "BRLTTYSR"
+#define SCREEN_RECORDING_VERSION 1
+
+typedef struct {
+  char magic[8];
+  uint16_t version;
+  uint16_t headerSize;
+  uint32_t reserved;
+} PACKED ScreenRecordingHeader;
+
+typedef enum {
+  SCREEN_RECORDING_FRAME_HAS_CURSOR = 0X01,
+  SCREEN_RECORDING_FRAME_HAS_SELECTION = 0X02
+} ScreenRecordingFrameFlags;
+
+typedef struct {
+  uint32_t frameSize; /* including this header */
+  uint32_t time; /* milliseconds since the start of the recording */
+
+  uint16_t columns;
+  uint16_t rows;
+  uint16_t cursorColumn;
+  uint16_t cursorRow;
+  uint32_t number;
+
+  uint8_t flags;
+  uint8_t quality;
+  uint16_t unreadableLength;
+  uint32_t spanCount;
+} PACKED ScreenRecordingFrame;
+
+typedef struct {
+  uint16_t row;
+  uint16_t column;
+  uint16_t count;
+} PACKED ScreenRecordingSpan;
+
+typedef struct {
+  uint32_t text;
+  uint8_t attributes;
+} PACKED ScreenRecordingCharacter;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_SCR_RECORDING */
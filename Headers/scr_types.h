@@ -84,6 +84,7 @@ typedef struct {
   int number;		      /* screen number */
   short cols, rows;	/* screen dimensions */
   short posx, posy;	/* cursor position */
+  short scrollback;	/* leading rows which have scrolled off the screen */
 
   unsigned char hasCursor:1;
   unsigned char hasSelection:1;
@@ -0,0 +1,106 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_TRACE
+#define BRLTTY_INCLUDED_TRACE
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The binary trace is a file of fixed-size records which is written when
+ * the trace file option is given, and which brltty-trace decodes. The
+ * records are native-endian, so it must be decoded on the same kind of host.
+ */
+
+#define TRACE_FILE_MAGIC "BRLTRACE"
+#define TRACE_FILE_VERSION 1
+#define TRACE_ARGUMENT_COUNT 5
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+  int64_t realTimeOffset; /* nanoseconds to add to a record's time */
+  uint32_t eventCount;
+  uint32_t reserved;
+} TraceFileHeader;
+
+typedef struct {
+  uint64_t time; /* monotonic nanoseconds */
+  uint16_t event;
+  uint16_t thread;
+  uint32_t arguments[TRACE_ARGUMENT_COUNT];
+} TraceRecord;
+
+typedef enum {
+  TRACE_FMT_NUMBERS, /* the arguments are given to the format */
+  TRACE_FMT_BYTES,   /* a count followed by up to 16 bytes */
+  TRACE_FMT_TEXT     /* up to 20 characters */
+} TraceFormat;
+
+/* TRACE_EVENT_ENTRY(identifier, name, format, template)
+ * Events may only be appended, so that old traces remain decodable.
+ */
+#define TRACE_EVENTS \
+  TRACE_EVENT_ENTRY(THREAD_NAME, "thread", TRACE_FMT_TEXT, NULL) \
+  TRACE_EVENT_ENTRY(UPDATE_BEGIN, "update begin", TRACE_FMT_NUMBERS, "") \
+  TRACE_EVENT_ENTRY(UPDATE_SCREEN, "update screen", TRACE_FMT_NUMBERS, "#%u %ux%u [%u,%u]") \
+  TRACE_EVENT_ENTRY(UPDATE_END, "update end", TRACE_FMT_NUMBERS, "") \
+  TRACE_EVENT_ENTRY(CURSOR_TRACK, "cursor tracking", TRACE_FMT_NUMBERS, "scr=%u csr=[%u,%u] win=[%u,%u]") \
+  TRACE_EVENT_ENTRY(BRAILLE_KEY, "braille key", TRACE_FMT_NUMBERS, "%u.%u press=%u context=%u state=%u") \
+  TRACE_EVENT_ENTRY(KEYBOARD_KEY, "keyboard key", TRACE_FMT_NUMBERS, "code=%u press=%u") \
+  TRACE_EVENT_ENTRY(COMMAND, "command", TRACE_FMT_NUMBERS, "%06X") \
+  TRACE_EVENT_ENTRY(INPUT_PACKET, "input packet", TRACE_FMT_BYTES, NULL) \
+  TRACE_EVENT_ENTRY(OUTPUT_PACKET, "output packet", TRACE_FMT_BYTES, NULL) \
+  TRACE_EVENT_ENTRY(GENERIC_INPUT, "generic input", TRACE_FMT_BYTES, NULL)
+
+typedef enum {
+#define TRACE_EVENT_ENTRY(identifier, name, format, template) TRACE_EVT_##identifier,
+  TRACE_EVENTS
+#undef TRACE_EVENT_ENTRY
+
+  TRACE_EVENT_COUNT
+} TraceEvent;
+
+extern unsigned char traceEnabled;
+#define TRACE_ENABLED() __atomic_load_n(&traceEnabled, __ATOMIC_RELAXED)
+extern void recordTraceEvent (TraceEvent event, const uint32_t *arguments);
+extern void recordTraceBytes (TraceEvent event, const void *bytes, size_t count);
+
+#define TRACE_EVENT(identifier, ...) do { \
+  if (TRACE_ENABLED()) { \
+    const uint32_t traceArguments[TRACE_ARGUMENT_COUNT] = {__VA_ARGS__}; \
+    recordTraceEvent(TRACE_EVT_##identifier, traceArguments); \
+  } \
+} while (0)
+
+#define TRACE_BYTES(identifier, bytes, count) do { \
+  if (TRACE_ENABLED()) recordTraceBytes(TRACE_EVT_##identifier, (bytes), (count)); \
+} while (0)
+
+extern int startTrace (const char *path);
+extern void stopTrace (void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_TRACE */
@@ -0,0 +1,842 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* apibench generates load against BRLTTY's API and measures its latency */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netdb.h>
+#include <pthread.h>
+
+#include "options.h"
+#include "log.h"
+#include "parse.h"
+#include "timing.h"
+#include "brl_cmds.h"
+
+#define BRLAPI_NO_DEPRECATED
+#define BRLAPI_NO_SINGLE_SESSION
+#include "brlapi.h"
+
+static char *opt_host;
+static char *opt_auth;
+static char *opt_connections;
+static char *opt_duration;
+static char *opt_writeRate;
+static char *opt_workloads;
+static char *opt_virtualDisplay;
+static char *opt_tty;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .letter = 'c',
+    .word = "connections",
+    .argument = "count",
+    .setting.string = &opt_connections,
+    .internal.setting = "4",
+    .description = "The number of concurrent connections to open."
+  },
+
+  { .letter = 'd',
+    .word = "duration",
+    .argument = "seconds",
+    .setting.string = &opt_duration,
+    .internal.setting = "10",
+    .description = "How long to generate load for."
+  },
+
+  { .letter = 'r',
+    .word = "rate",
+    .argument = "writesPerSecond",
+    .setting.string = &opt_writeRate,
+    .internal.setting = "50",
+    .description = "The target write rate of each writing connection."
+  },
+
+  { .letter = 'w',
+    .word = "workloads",
+    .argument = "workload,...",
+    .setting.string = &opt_workloads,
+    .internal.setting = "write,parameter,watch",
+    .description = "The workloads (write, parameter, watch, raw, key) to assign to the connections in turn - raw sends packets to the braille device."
+  },
+
+  { .letter = 'v',
+    .word = "virtual",
+    .argument = "[host]:port|/path",
+    .setting.string = &opt_virtualDisplay,
+    .description = "The socket of a Virtual braille driver (in server mode) to inject keys through."
+  },
+
+  { .letter = 't',
+    .word = "tty",
+    .argument = "number",
+    .setting.string = &opt_tty,
+    .internal.setting = "-1",
+    .description = "The tty to enter tty mode on."
+  },
+
+  { .letter = 'b',
+    .word = "brlapi",
+    .argument = "[host][:port]",
+    .setting.string = &opt_host,
+    .description = "BrlAPIa host and/or port to connect to."
+  },
+
+  { .letter = 'a',
+    .word = "auth",
+    .argument = "scheme+...",
+    .setting.string = &opt_auth,
+    .description = "BrlAPI authorization/authentication schemes."
+  },
+END_OPTION_TABLE
+
+typedef enum {
+  OP_WRITE,
+  OP_PARAMETER,
+  OP_WATCH,
+  OP_RAW,
+  OP_KEY,
+  OP_COUNT /* must be last */
+} OperationType;
+
+static const char *const operationNames[OP_COUNT] = {
+  [OP_WRITE] = "write",
+  [OP_PARAMETER] = "parameter",
+  [OP_WATCH] = "watch",
+  [OP_RAW] = "raw",
+  [OP_KEY] = "key",
+};
+
+typedef struct {
+  unsigned long *samples;
+  size_t count;
+  size_t size;
+  unsigned long errors;
+} OperationStatistics;
+
+typedef struct {
+  pthread_t thread;
+  unsigned int identifier;
+  OperationType workload;
+  brlapi_handle_t *handle;
+  OperationStatistics statistics[OP_COUNT];
+} ConnectionEntry;
+
+static ConnectionEntry *connections = NULL;
+static unsigned int connectionCount;
+
+static int durationSeconds;
+static int writeRate;
+static int ttyNumber;
+
+static TimeValue benchmarkStart;
+static volatile int benchmarkStopping = 0;
+
+static int virtualSocket = -1;
+static pthread_mutex_t virtualKeyMutex = PTHREAD_MUTEX_INITIALIZER;
+#define VIRTUAL_COLUMNS 40
+
+static unsigned long
+microsecondsSince (const TimeValue *start) {
+  TimeValue now;
+  getMonotonicTime(&now);
+
+  return ((now.seconds - start->seconds) * USECS_PER_SEC)
+       + ((now.nanoseconds - start->nanoseconds) / NSECS_PER_USEC);
+}
+
+static int
+isBenchmarkOver (void) {
+  if (benchmarkStopping) return 1;
+  return getMonotonicElapsed(&benchmarkStart) >= (durationSeconds * MSECS_PER_SEC);
+}
+
+static void
+addSample (OperationStatistics *statistics, unsigned long microseconds) {
+  if (statistics->count == statistics->size) {
+    size_t newSize = statistics->size? (statistics->size << 1): 0X100;
+    unsigned long *newSamples = realloc(statistics->samples, ARRAY_SIZE(newSamples, newSize));
+
+    if (!newSamples) {
+      logMallocError();
+      statistics->errors += 1;
+      return;
+    }
+
+    statistics->samples = newSamples;
+    statistics->size = newSize;
+  }
+
+  statistics->samples[statistics->count++] = microseconds;
+}
+
+static void
+logConnectionError (ConnectionEntry *connection, const char *action) {
+  logMessage(LOG_WARNING, "connection %u: %s failed: %s",
+             connection->identifier, action,
+             brlapi_strerror(brlapi_error_location()));
+}
+
+static void BRLAPI_STDCALL
+handleException (brlapi_handle_t *handle, int error, brlapi_packetType_t type, const void *packet, size_t size) {
+  ConnectionEntry *connection = brlapi__getClientData(handle);
+
+  char message[0X100];
+
+  brlapi__strexception(handle, message, sizeof(message), error, type, packet, size);
+  logMessage(LOG_WARNING, "connection %u: %s", connection->identifier, message);
+  connection->statistics[connection->workload].errors += 1;
+}
+
+static void
+runWriteWorkload (ConnectionEntry *connection) {
+  OperationStatistics *statistics = &connection->statistics[OP_WRITE];
+  unsigned int columns, rows;
+
+  if (brlapi__getDisplaySize(connection->handle, &columns, &rows) == -1) {
+    logConnectionError(connection, "getDisplaySize");
+    return;
+  }
+
+  if (brlapi__enterTtyMode(connection->handle, ttyNumber, NULL) == -1) {
+    logConnectionError(connection, "enterTtyMode");
+    return;
+  }
+
+  /* Leave the injected keys to the connections running the key workload. */
+  if (brlapi__ignoreAllKeys(connection->handle) == -1) {
+    logConnectionError(connection, "ignoreAllKeys");
+  }
+
+  {
+    const long int interval = USECS_PER_SEC / writeRate;
+    unsigned long counter = 0;
+    TimeValue next;
+
+    getMonotonicTime(&next);
+
+    while (!isBenchmarkOver()) {
+      char text[(columns * rows) + 1];
+      TimeValue start;
+
+      snprintf(text, sizeof(text), "connection %u write %lu", connection->identifier, counter++);
+      getMonotonicTime(&start);
+
+      if (brlapi__writeText(connection->handle, BRLAPI_CURSOR_OFF, text) == -1) {
+        statistics->errors += 1;
+      } else {
+        addSample(statistics, microsecondsSince(&start));
+      }
+
+      next.nanoseconds += interval * NSECS_PER_USEC;
+      normalizeTimeValue(&next);
+
+      {
+        TimeValue now;
+        getMonotonicTime(&now);
+
+        if (compareTimeValues(&next, &now) > 0) {
+          TimeValue delay = {
+            .seconds = next.seconds - now.seconds,
+            .nanoseconds = next.nanoseconds - now.nanoseconds
+          };
+
+          normalizeTimeValue(&delay);
+          accurateDelay(&delay);
+        } else {
+          next = now;
+        }
+      }
+    }
+  }
+
+  brlapi__leaveTtyMode(connection->handle);
+}
+
+static void
+runParameterWorkload (ConnectionEntry *connection) {
+  OperationStatistics *statistics = &connection->statistics[OP_PARAMETER];
+
+  while (!isBenchmarkOver()) {
+    brlapi_param_displaySize_t size;
+    TimeValue start;
+
+    getMonotonicTime(&start);
+
+    if (brlapi__getParameter(connection->handle, BRLAPI_PARAM_DISPLAY_SIZE, 0,
+                             BRLAPI_PARAMF_GLOBAL, &size, sizeof(size)) == -1) {
+      statistics->errors += 1;
+    } else {
+      addSample(statistics, microsecondsSince(&start));
+    }
+  }
+}
+
+static void
+handleWatchedParameter (
+  brlapi_param_t parameter, brlapi_param_subparam_t subparam,
+  brlapi_param_flags_t flags, void *data,
+  const void *value, size_t length
+) {
+}
+
+static void
+runWatchWorkload (ConnectionEntry *connection) {
+  OperationStatistics *statistics = &connection->statistics[OP_WATCH];
+
+  while (!isBenchmarkOver()) {
+    brlapi_paramCallbackDescriptor_t descriptor;
+    TimeValue start;
+
+    getMonotonicTime(&start);
+
+    descriptor = brlapi__watchParameter(connection->handle, BRLAPI_PARAM_RETAIN_DOTS, 0,
+                                        BRLAPI_PARAMF_LOCAL, handleWatchedParameter,
+                                        connection, NULL, 0);
+
+    if (!descriptor) {
+      statistics->errors += 1;
+    } else if (brlapi__unwatchParameter(connection->handle, descriptor) == -1) {
+      statistics->errors += 1;
+    } else {
+      addSample(statistics, microsecondsSince(&start));
+    }
+  }
+}
+
+static void
+runRawWorkload (ConnectionEntry *connection) {
+  OperationStatistics *statistics = &connection->statistics[OP_RAW];
+  char driver[0X20];
+
+  if (brlapi__getDriverName(connection->handle, driver, sizeof(driver)) == -1) {
+    logConnectionError(connection, "getDriverName");
+    return;
+  }
+
+  while (!isBenchmarkOver()) {
+    static const unsigned char packet[] = {0};
+    TimeValue start;
+
+    getMonotonicTime(&start);
+
+    if (brlapi__enterRawMode(connection->handle, driver) == -1) {
+      statistics->errors += 1;
+
+      /* Another connection holds raw mode, or the driver doesn't support it. */
+      approximateDelay(10);
+      continue;
+    }
+
+    if (brlapi__sendRaw(connection->handle, packet, sizeof(packet)) == -1) {
+      statistics->errors += 1;
+    }
+
+    if (brlapi__leaveRawMode(connection->handle) == -1) {
+      statistics->errors += 1;
+    } else {
+      addSample(statistics, microsecondsSince(&start));
+    }
+  }
+}
+
+static int
+openVirtualSocket (const char *address) {
+  int socketDescriptor = -1;
+
+  if (address[0] == '/') {
+    struct sockaddr_un local;
+
+    memset(&local, 0, sizeof(local));
+    local.sun_family = AF_LOCAL;
+
+    if (strlen(address) >= sizeof(local.sun_path)) {
+      logMessage(LOG_ERR, "virtual display path too long: %s", address);
+      return -1;
+    }
+
+    strcpy(local.sun_path, address);
+
+    if ((socketDescriptor = socket(PF_LOCAL, SOCK_STREAM, 0)) == -1) {
+      logSystemError("socket");
+      return -1;
+    }
+
+    if (connect(socketDescriptor, (struct sockaddr *)&local, sizeof(local)) == -1) {
+      logSystemError("connect");
+      close(socketDescriptor);
+      return -1;
+    }
+  } else {
+    const char *colon = strrchr(address, ':');
+    char host[0X100];
+    const char *port = "35752";
+    struct addrinfo hints, *info;
+    int error;
+
+    if (colon) {
+      size_t length = colon - address;
+
+      if (length >= sizeof(host)) length = sizeof(host) - 1;
+      memcpy(host, address, length);
+      host[length] = 0;
+      if (colon[1]) port = colon + 1;
+    } else {
+      snprintf(host, sizeof(host), "%s", address);
+    }
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    if ((error = getaddrinfo(*host? host: "localhost", port, &hints, &info))) {
+      logMessage(LOG_ERR, "virtual display address error: %s: %s", address, gai_strerror(error));
+      return -1;
+    }
+
+    {
+      const struct addrinfo *entry;
+
+      for (entry=info; entry; entry=entry->ai_next) {
+        if ((socketDescriptor = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol)) == -1) continue;
+        if (connect(socketDescriptor, entry->ai_addr, entry->ai_addrlen) != -1) break;
+
+        close(socketDescriptor);
+        socketDescriptor = -1;
+      }
+    }
+
+    freeaddrinfo(info);
+
+    if (socketDescriptor == -1) {
+      logMessage(LOG_ERR, "virtual display connection error: %s", address);
+      return -1;
+    }
+  }
+
+  return socketDescriptor;
+}
+
+static int
+sendVirtualCommand (const char *command) {
+  size_t length = strlen(command);
+
+  while (length) {
+    ssize_t count = send(virtualSocket, command, length, 0);
+
+    if (count == -1) {
+      if (errno == EINTR) continue;
+      logSystemError("send");
+      return 0;
+    }
+
+    command += count;
+    length -= count;
+  }
+
+  return 1;
+}
+
+static void *
+drainVirtualSocket (void *argument) {
+  char buffer[0X400];
+
+  /* The driver blocks if what it sends to the display isn't consumed. */
+  while (1) {
+    ssize_t count = recv(virtualSocket, buffer, sizeof(buffer), 0);
+
+    if (count == -1) {
+      if (errno == EINTR) continue;
+      logSystemError("recv");
+      break;
+    }
+
+    if (!count) break;
+  }
+
+  return NULL;
+}
+
+static int
+awaitVirtualDisplay (void) {
+  int ready = 0;
+  brlapi_handle_t *handle = malloc(brlapi_getHandleSize());
+
+  if (handle) {
+    brlapi_connectionSettings_t settings = {
+      .host = opt_host,
+      .auth = opt_auth
+    };
+
+    if (brlapi__openConnection(handle, &settings, NULL) != (brlapi_fileDescriptor)-1) {
+      TimePeriod period;
+      startTimePeriod(&period, 10000);
+
+      /* The core keeps using the previous dimensions until the driver is up. */
+      while (1) {
+        unsigned int columns, rows;
+
+        if (brlapi__getDisplaySize(handle, &columns, &rows) == -1) break;
+
+        if ((columns == VIRTUAL_COLUMNS) && (rows == 1)) {
+          ready = 1;
+          break;
+        }
+
+        if (afterTimePeriod(&period, NULL)) {
+          logMessage(LOG_ERR, "virtual display not ready: %s", opt_virtualDisplay);
+          break;
+        }
+
+        approximateDelay(100);
+      }
+
+      brlapi__closeConnection(handle);
+    } else {
+      logMessage(LOG_ERR, "openConnection failed: %s", brlapi_strerror(brlapi_error_location()));
+    }
+
+    free(handle);
+  } else {
+    logMallocError();
+  }
+
+  return ready;
+}
+
+static void
+runKeyWorkload (ConnectionEntry *connection) {
+  OperationStatistics *statistics = &connection->statistics[OP_KEY];
+
+  if (virtualSocket == -1) {
+    logMessage(LOG_WARNING, "connection %u: key workload requires a virtual display", connection->identifier);
+    return;
+  }
+
+  if (brlapi__enterTtyMode(connection->handle, ttyNumber, NULL) == -1) {
+    logConnectionError(connection, "enterTtyMode");
+    return;
+  }
+
+  while (!isBenchmarkOver()) {
+    brlapi_keyCode_t key;
+    TimeValue start;
+    int result;
+
+    /* Only one injected key is outstanding at a time so that a key which
+     * this connection reads is known to be the one it injected.
+     */
+    pthread_mutex_lock(&virtualKeyMutex);
+
+    /* Discard keys delivered here while another connection was injecting. */
+    while (brlapi__readKeyWithTimeout(connection->handle, 0, &key) == 1);
+
+    getMonotonicTime(&start);
+
+    if (!sendVirtualCommand("LnDn\n")) {
+      pthread_mutex_unlock(&virtualKeyMutex);
+      break;
+    }
+
+    result = brlapi__readKeyWithTimeout(connection->handle, 1000, &key);
+    pthread_mutex_unlock(&virtualKeyMutex);
+
+    if (result == 1) {
+      addSample(statistics, microsecondsSince(&start));
+    } else {
+      /* The key went to another client, or to the core itself. */
+      statistics->errors += 1;
+    }
+  }
+
+  brlapi__leaveTtyMode(connection->handle);
+}
+
+typedef void WorkloadRunner (ConnectionEntry *connection);
+
+static WorkloadRunner *const workloadRunners[OP_COUNT] = {
+  [OP_WRITE] = runWriteWorkload,
+  [OP_PARAMETER] = runParameterWorkload,
+  [OP_WATCH] = runWatchWorkload,
+  [OP_RAW] = runRawWorkload,
+  [OP_KEY] = runKeyWorkload,
+};
+
+static void *
+runConnection (void *argument) {
+  ConnectionEntry *connection = argument;
+  brlapi_connectionSettings_t settings = {
+    .host = opt_host,
+    .auth = opt_auth
+  };
+
+  if (brlapi__openConnection(connection->handle, &settings, NULL) == (brlapi_fileDescriptor)-1) {
+    logConnectionError(connection, "openConnection");
+    connection->statistics[connection->workload].errors += 1;
+    return NULL;
+  }
+
+  brlapi__setClientData(connection->handle, connection);
+  brlapi__setExceptionHandler(connection->handle, handleException);
+
+  workloadRunners[connection->workload](connection);
+
+  brlapi__closeConnection(connection->handle);
+  return NULL;
+}
+
+static int
+compareSamples (const void *element1, const void *element2) {
+  const unsigned long *sample1 = element1;
+  const unsigned long *sample2 = element2;
+
+  if (*sample1 < *sample2) return -1;
+  if (*sample1 > *sample2) return 1;
+  return 0;
+}
+
+static unsigned long
+getPercentile (const unsigned long *samples, size_t count, unsigned int percentile) {
+  size_t index = ((count * percentile) + 99) / 100;
+
+  if (index) index -= 1;
+  if (index >= count) index = count - 1;
+  return samples[index];
+}
+
+static void
+reportStatistics (void) {
+  unsigned long elapsed = microsecondsSince(&benchmarkStart);
+  double seconds = (double)elapsed / USECS_PER_SEC;
+
+  printf("%-10s %8s %10s %8s %8s %8s %8s %8s\n",
+         "operation", "count", "per-second", "errors",
+         "p50-us", "p90-us", "p99-us", "max-us");
+
+  for (OperationType type=0; type<OP_COUNT; type+=1) {
+    OperationStatistics total = {
+      .samples = NULL
+    };
+
+    for (unsigned int index=0; index<connectionCount; index+=1) {
+      const OperationStatistics *statistics = &connections[index].statistics[type];
+
+      total.count += statistics->count;
+      total.errors += statistics->errors;
+    }
+
+    if (!(total.count || total.errors)) continue;
+
+    if (total.count) {
+      if (!(total.samples = malloc(ARRAY_SIZE(total.samples, total.count)))) {
+        logMallocError();
+        continue;
+      }
+
+      {
+        size_t count = 0;
+
+        for (unsigned int index=0; index<connectionCount; index+=1) {
+          const OperationStatistics *statistics = &connections[index].statistics[type];
+
+          memcpy(&total.samples[count], statistics->samples,
+                 ARRAY_SIZE(statistics->samples, statistics->count));
+          count += statistics->count;
+        }
+      }
+
+      qsort(total.samples, total.count, sizeof(*total.samples), compareSamples);
+
+      printf("%-10s %8zu %10.1f %8lu %8lu %8lu %8lu %8lu\n",
+             operationNames[type], total.count, total.count / seconds, total.errors,
+             getPercentile(total.samples, total.count, 50),
+             getPercentile(total.samples, total.count, 90),
+             getPercentile(total.samples, total.count, 99),
+             total.samples[total.count - 1]);
+
+      free(total.samples);
+    } else {
+      printf("%-10s %8zu %10.1f %8lu %8s %8s %8s %8s\n",
+             operationNames[type], total.count, 0.0, total.errors,
+             "-", "-", "-", "-");
+    }
+  }
+}
+
+static int
+parseWorkloads (OperationType **workloads, unsigned int *count) {
+  int ok = 1;
+  int wordCount;
+  char **words = splitString(opt_workloads, ',', &wordCount);
+
+  if (!words) return 0;
+
+  if (!wordCount) {
+    logMessage(LOG_ERR, "no workloads specified");
+    ok = 0;
+  } else if (!(*workloads = malloc(ARRAY_SIZE(*workloads, wordCount)))) {
+    logMallocError();
+    ok = 0;
+  } else {
+    *count = wordCount;
+
+    for (unsigned int index=0; index<wordCount; index+=1) {
+      const char *word = words[index];
+      OperationType type = 0;
+
+      while (1) {
+        if (type == OP_COUNT) {
+          logMessage(LOG_ERR, "unknown workload: %s", word);
+          ok = 0;
+          break;
+        }
+
+        if (strcmp(word, operationNames[type]) == 0) {
+          (*workloads)[index] = type;
+          break;
+        }
+
+        type += 1;
+      }
+    }
+
+    if (!ok) free(*workloads);
+  }
+
+  deallocateStrings(words);
+  return ok;
+}
+
+static int
+parseIntegerOption (int *value, const char *string, const char *name, int minimum, int maximum) {
+  if (validateInteger(value, string, &minimum, &maximum)) return 1;
+  logMessage(LOG_ERR, "invalid %s: %s", name, string);
+  return 0;
+}
+
+int
+main (int argc, char *argv[]) {
+  ProgramExitStatus exitStatus = PROG_EXIT_SUCCESS;
+  OperationType *workloads;
+  unsigned int workloadCount;
+  int count;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "apibench"
+    };
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!parseIntegerOption(&count, opt_connections, "connection count", 1, 1000)) return PROG_EXIT_SYNTAX;
+  if (!parseIntegerOption(&durationSeconds, opt_duration, "duration", 1, SECS_PER_DAY)) return PROG_EXIT_SYNTAX;
+  if (!parseIntegerOption(&writeRate, opt_writeRate, "write rate", 1, 100000)) return PROG_EXIT_SYNTAX;
+  if (!parseIntegerOption(&ttyNumber, opt_tty, "tty number", -1, 0XFFFF)) return PROG_EXIT_SYNTAX;
+  if (!parseWorkloads(&workloads, &workloadCount)) return PROG_EXIT_SYNTAX;
+  connectionCount = count;
+
+  if (opt_virtualDisplay && *opt_virtualDisplay) {
+    if ((virtualSocket = openVirtualSocket(opt_virtualDisplay)) == -1) return PROG_EXIT_FATAL;
+
+    {
+      char command[0X20];
+
+      /* The driver waits for the dimensions of the display before anything else. */
+      snprintf(command, sizeof(command), "cells %u\n", VIRTUAL_COLUMNS);
+      if (!sendVirtualCommand(command)) return PROG_EXIT_FATAL;
+    }
+
+    {
+      pthread_t thread;
+      int error = pthread_create(&thread, NULL, drainVirtualSocket, NULL);
+
+      if (error) {
+        logActionError(error, "pthread_create");
+        return PROG_EXIT_FATAL;
+      }
+
+      pthread_detach(thread);
+    }
+
+    if (!awaitVirtualDisplay()) return PROG_EXIT_FATAL;
+  }
+
+  if (!(connections = calloc(connectionCount, sizeof(*connections)))) {
+    logMallocError();
+    return PROG_EXIT_FATAL;
+  }
+
+  for (unsigned int index=0; index<connectionCount; index+=1) {
+    ConnectionEntry *connection = &connections[index];
+
+    connection->identifier = index;
+    connection->workload = workloads[index % workloadCount];
+
+    if (!(connection->handle = malloc(brlapi_getHandleSize()))) {
+      logMallocError();
+      return PROG_EXIT_FATAL;
+    }
+  }
+
+  fprintf(stderr, "Running %u connection(s) for %d second(s)\n", connectionCount, durationSeconds);
+  getMonotonicTime(&benchmarkStart);
+
+  {
+    unsigned int started = 0;
+
+    while (started < connectionCount) {
+      ConnectionEntry *connection = &connections[started];
+      int error = pthread_create(&connection->thread, NULL, runConnection, connection);
+
+      if (error) {
+        logActionError(error, "pthread_create");
+        benchmarkStopping = 1;
+        exitStatus = PROG_EXIT_FATAL;
+        break;
+      }
+
+      started += 1;
+    }
+
+    while (started) pthread_join(connections[--started].thread, NULL);
+  }
+
+  reportStatistics();
+
+  for (unsigned int index=0; index<connectionCount; index+=1) {
+    ConnectionEntry *connection = &connections[index];
+
+    for (OperationType type=0; type<OP_COUNT; type+=1) {
+      if (connection->statistics[type].samples) free(connection->statistics[type].samples);
+    }
+
+    free(connection->handle);
+  }
+
+  free(connections);
+  free(workloads);
+  if (virtualSocket != -1) close(virtualSocket);
+  return exitStatus;
+}
@@ -19,14 +19,31 @@
 #include "prologue.h"
 
 #include <string.h>
+#include <limits.h>
 
 #include "log.h"
 #include "async_alarm.h"
 #include "async_internal.h"
 #include "timing.h"
 
-typedef struct {
+/* Alarms are kept in an (unordered) queue so that handles work as they do
+ * for every other kind of asynchronous request, and, for scheduling, in an
+ * indexed binary min-heap so that adding, resetting, and removing an alarm
+ * are all O(log n). Alarm entries are recycled via a per-thread free list.
+ */
+
+#define ALARM_NOT_SCHEDULED UINT_MAX
+
+typedef struct AlarmEntryStruct AlarmEntry;
+
+struct AlarmEntryStruct {
+  AsyncAlarmData *alarmData;
+  Element *element;
+  AlarmEntry *next;
+
   TimeValue time;
+  unsigned long int sequence;
+  unsigned int index;
   int interval;
 
   AsyncAlarmCallback *callback;
@@ -35,16 +52,33 @@ typedef struct {
   unsigned active:1;
   unsigned cancel:1;
   unsigned reschedule:1;
-} AlarmEntry;
+};
 
 struct AsyncAlarmDataStruct {
   Queue *alarmQueue;
+
+  struct {
+    AlarmEntry **array;
+    unsigned int size;
+    unsigned int count;
+    unsigned long int sequence;
+  } heap;
+
+  AlarmEntry *freeAlarms;
 };
 
 void
 asyncDeallocateAlarmData (AsyncAlarmData *ad) {
   if (ad) {
     if (ad->alarmQueue) deallocateQueue(ad->alarmQueue);
+    if (ad->heap.array) free(ad->heap.array);
+
+    while (ad->freeAlarms) {
+      AlarmEntry *alarm = ad->freeAlarms;
+      ad->freeAlarms = alarm->next;
+      free(alarm);
+    }
+
     free(ad);
   }
 }
@@ -64,12 +98,130 @@ getAlarmData (void) {
 
     memset(ad, 0, sizeof(*ad));
     ad->alarmQueue = NULL;
+
+    ad->heap.array = NULL;
+    ad->heap.size = 0;
+    ad->heap.count = 0;
+    ad->heap.sequence = 0;
+
+    ad->freeAlarms = NULL;
+
     tsd->alarmData = ad;
   }
 
   return tsd->alarmData;
 }
 
+static int
+isEarlierAlarm (const AlarmEntry *alarm1, const AlarmEntry *alarm2) {
+  int relation = compareTimeValues(&alarm1->time, &alarm2->time);
+
+  if (relation) return relation < 0;
+  return alarm1->sequence < alarm2->sequence;
+}
+
+static void
+setHeapEntry (AsyncAlarmData *ad, unsigned int index, AlarmEntry *alarm) {
+  ad->heap.array[index] = alarm;
+  alarm->index = index;
+}
+
+static void
+moveAlarmUp (AsyncAlarmData *ad, AlarmEntry *alarm) {
+  unsigned int index = alarm->index;
+
+  while (index > 0) {
+    unsigned int parent = (index - 1) / 2;
+    AlarmEntry *above = ad->heap.array[parent];
+
+    if (!isEarlierAlarm(alarm, above)) break;
+    setHeapEntry(ad, index, above);
+    index = parent;
+  }
+
+  setHeapEntry(ad, index, alarm);
+}
+
+static void
+moveAlarmDown (AsyncAlarmData *ad, AlarmEntry *alarm) {
+  unsigned int index = alarm->index;
+
+  while (1) {
+    unsigned int child = (index * 2) + 1;
+    AlarmEntry *below;
+
+    if (child >= ad->heap.count) break;
+    below = ad->heap.array[child];
+
+    {
+      unsigned int sibling = child + 1;
+
+      if (sibling < ad->heap.count) {
+        AlarmEntry *other = ad->heap.array[sibling];
+
+        if (isEarlierAlarm(other, below)) {
+          child = sibling;
+          below = other;
+        }
+      }
+    }
+
+    if (!isEarlierAlarm(below, alarm)) break;
+    setHeapEntry(ad, index, below);
+    index = child;
+  }
+
+  setHeapEntry(ad, index, alarm);
+}
+
+static int
+scheduleAlarm (AlarmEntry *alarm) {
+  AsyncAlarmData *ad = alarm->alarmData;
+
+  alarm->sequence = ++ad->heap.sequence;
+
+  if (alarm->index == ALARM_NOT_SCHEDULED) {
+    if (ad->heap.count == ad->heap.size) {
+      unsigned int newSize = ad->heap.size? ad->heap.size << 1: 0X10;
+      AlarmEntry **newArray = realloc(ad->heap.array, ARRAY_SIZE(newArray, newSize));
+
+      if (!newArray) {
+        logMallocError();
+        return 0;
+      }
+
+      ad->heap.array = newArray;
+      ad->heap.size = newSize;
+    }
+
+    setHeapEntry(ad, ad->heap.count++, alarm);
+    moveAlarmUp(ad, alarm);
+  } else {
+    moveAlarmUp(ad, alarm);
+    moveAlarmDown(ad, alarm);
+  }
+
+  return 1;
+}
+
+static void
+unscheduleAlarm (AlarmEntry *alarm) {
+  unsigned int index = alarm->index;
+
+  if (index != ALARM_NOT_SCHEDULED) {
+    AsyncAlarmData *ad = alarm->alarmData;
+    AlarmEntry *last = ad->heap.array[--ad->heap.count];
+
+    alarm->index = ALARM_NOT_SCHEDULED;
+
+    if (last != alarm) {
+      setHeapEntry(ad, index, last);
+      moveAlarmUp(ad, last);
+      moveAlarmDown(ad, last);
+    }
+  }
+}
+
 static void
 cancelAlarm (Element *element) {
   AlarmEntry *alarm = getElementItem(element);
@@ -84,16 +236,29 @@ cancelAlarm (Element *element) {
 static void
 deallocateAlarmEntry (void *item, void *data) {
   AlarmEntry *alarm = item;
+  AsyncAlarmData *ad = alarm->alarmData;
+
+  unscheduleAlarm(alarm);
 
-  free(alarm);
+  alarm->next = ad->freeAlarms;
+  ad->freeAlarms = alarm;
 }
 
-static int
-compareAlarmEntries (const void *newItem, const void *existingItem, void *queueData) {
-  const AlarmEntry *newAlarm = newItem;
-  const AlarmEntry *existingAlarm = existingItem;
+static AlarmEntry *
+allocateAlarmEntry (AsyncAlarmData *ad) {
+  AlarmEntry *alarm = ad->freeAlarms;
+
+  if (alarm) {
+    ad->freeAlarms = alarm->next;
+  } else if (!(alarm = malloc(sizeof(*alarm)))) {
+    logMallocError();
+    return NULL;
+  }
 
-  return compareTimeValues(&newAlarm->time, &existingAlarm->time) < 0;
+  memset(alarm, 0, sizeof(*alarm));
+  alarm->alarmData = ad;
+  alarm->index = ALARM_NOT_SCHEDULED;
+  return alarm;
 }
 
 static Queue *
@@ -102,7 +267,7 @@ getAlarmQueue (int create) {
   if (!ad) return NULL;
 
   if (!ad->alarmQueue && create) {
-    if ((ad->alarmQueue = newQueue(deallocateAlarmEntry, compareAlarmEntries))) {
+    if ((ad->alarmQueue = newQueue(deallocateAlarmEntry, NULL))) {
       static AsyncQueueMethods methods = {
         .cancelRequest = cancelAlarm
       };
@@ -126,11 +291,10 @@ newAlarmElement (const void *parameters) {
   Queue *alarms = getAlarmQueue(1);
 
   if (alarms) {
+    AsyncAlarmData *ad = getAlarmData();
     AlarmEntry *alarm;
 
-    if ((alarm = malloc(sizeof(*alarm)))) {
-      memset(alarm, 0, sizeof(*alarm));
-
+    if ((alarm = allocateAlarmEntry(ad))) {
       alarm->time = *aep->time;
 
       alarm->callback = aep->callback;
@@ -140,18 +304,17 @@ newAlarmElement (const void *parameters) {
       alarm->cancel = 0;
       alarm->reschedule = 0;
 
-      {
+      if (scheduleAlarm(alarm)) {
         Element *element = enqueueItem(alarms, alarm);
 
         if (element) {
+          alarm->element = element;
           logSymbol(LOG_CATEGORY(ASYNC_EVENTS), aep->callback, "alarm added");
           return element;
         }
       }
 
-      free(alarm);
-    } else {
-      logMallocError();
+      deallocateAlarmEntry(alarm, NULL);
     }
   }
 
@@ -201,7 +364,9 @@ asyncResetAlarmTo (AsyncHandle handle, const TimeValue *time) {
     AlarmEntry *alarm = getElementItem(element);
 
     alarm->time = *time;
-    requeueElement(element);
+
+    /* an alarm whose callback is running is rescheduled when it returns */
+    if (!alarm->active) scheduleAlarm(alarm);
     return 1;
   }
 
@@ -232,58 +397,55 @@ asyncResetAlarmInterval (AsyncHandle handle, int milliseconds) {
   return 0;
 }
 
-static int
-testInactiveAlarm (void *item, void *data) {
-  const AlarmEntry *alarm = item;
-
-  return !alarm->active;
-}
-
 int
 asyncExecuteAlarmCallback (AsyncAlarmData *ad, long int *timeout) {
   if (ad) {
-    Queue *alarms = ad->alarmQueue;
-
-    if (alarms) {
-      Element *element = processQueue(alarms, testInactiveAlarm, NULL);
-
-      if (element) {
-        AlarmEntry *alarm = getElementItem(element);
-        TimeValue now;
-        long int milliseconds;
-
-        getMonotonicTime(&now);
-        milliseconds = millisecondsBetween(&now, &alarm->time);
-
-        if (milliseconds <= 0) {
-          AsyncAlarmCallback *callback = alarm->callback;
-          const AsyncAlarmCallbackParameters parameters = {
-            .now = &now,
-            .data = alarm->data
-          };
-
-          logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "alarm starting");
-          alarm->active = 1;
-          if (callback) callback(&parameters);
-          alarm->active = 0;
-
-          if (alarm->reschedule) {
-            adjustTimeValue(&alarm->time, alarm->interval);
-            getMonotonicTime(&now);
-            if (compareTimeValues(&alarm->time, &now) < 0) alarm->time = now;
-            requeueElement(element);
-          } else {
-            alarm->cancel = 1;
-          }
-
-          if (alarm->cancel) deleteElement(element);
-          return 1;
+    if (ad->heap.count) {
+      AlarmEntry *alarm = ad->heap.array[0];
+      TimeValue now;
+      long int milliseconds;
+
+      getMonotonicTime(&now);
+      milliseconds = millisecondsBetween(&now, &alarm->time);
+
+      if (milliseconds <= 0) {
+        Element *element = alarm->element;
+        AsyncAlarmCallback *callback = alarm->callback;
+        const AsyncAlarmCallbackParameters parameters = {
+          .now = &now,
+          .data = alarm->data
+        };
+
+        AsyncCallbackTimer timer;
+
+        logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "alarm starting");
+        unscheduleAlarm(alarm);
+        alarm->active = 1;
+
+        if (callback) {
+          asyncStartCallbackTimer(&timer);
+          callback(&parameters);
+          asyncStopCallbackTimer(&timer, "alarm", callback);
         }
 
-        if (milliseconds < *timeout) {
-          *timeout = milliseconds;
-          logSymbol(LOG_CATEGORY(ASYNC_EVENTS), alarm->callback, "next alarm: %ld", *timeout);
+        alarm->active = 0;
+
+        if (alarm->reschedule) {
+          adjustTimeValue(&alarm->time, alarm->interval);
+          getMonotonicTime(&now);
+          if (compareTimeValues(&alarm->time, &now) < 0) alarm->time = now;
+          if (!scheduleAlarm(alarm)) alarm->cancel = 1;
+        } else {
+          alarm->cancel = 1;
         }
+
+        if (alarm->cancel) deleteElement(element);
+        return 1;
+      }
+
+      if (milliseconds < *timeout) {
+        *timeout = milliseconds;
+        logSymbol(LOG_CATEGORY(ASYNC_EVENTS), alarm->callback, "next alarm: %ld", *timeout);
       }
     }
   }
@@ -19,19 +19,46 @@
 #include "prologue.h"
 
 #include <string.h>
+#include <errno.h>
+
+#if defined(HAVE_SYS_EVENTFD_H) && defined(__ATOMIC_ACQ_REL)
+#define ASYNC_EVENT_USE_EVENTFD
+#include <sys/eventfd.h>
+#endif /* eventfd */
 
 #include "log.h"
 #include "async_io.h"
+#include "async_alarm.h"
 #include "async_event.h"
 #include "async_internal.h"
 #include "file.h"
 
+#ifdef ASYNC_EVENT_USE_EVENTFD
+/* Signals are pushed onto a lock-free list by any thread and the eventfd is
+ * only written when the list goes from empty to nonempty, so a burst of
+ * signals costs a single wakeup, which then delivers all of them in order.
+ */
+
+typedef struct SignalEntryStruct SignalEntry;
+
+struct SignalEntryStruct {
+  SignalEntry *next;
+  void *data;
+};
+#endif /* ASYNC_EVENT_USE_EVENTFD */
+
 struct AsyncEventStruct {
   AsyncEventCallback *callback;
   void *data;
 
+#ifdef ASYNC_EVENT_USE_EVENTFD
+  SignalEntry *pendingSignals;
+  unsigned active:1;
+  unsigned discard:1;
+#else /* ASYNC_EVENT_USE_EVENTFD */
   FileDescriptor pipeInput;
   FileDescriptor pipeOutput;
+#endif /* ASYNC_EVENT_USE_EVENTFD */
 
   FileDescriptor monitorDescriptor;
   AsyncHandle monitorHandle;
@@ -42,6 +69,182 @@ struct AsyncEventStruct {
 #endif /* __MINGW32__ */
 };
 
+static void
+invokeEventCallback (AsyncEvent *event, void *data) {
+  AsyncEventCallback *callback = event->callback;
+
+  const AsyncEventCallbackParameters parameters = {
+    .eventData = event->data,
+    .signalData = data
+  };
+
+  logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "event starting");
+
+  if (callback) {
+    AsyncCallbackTimer timer;
+
+    asyncStartCallbackTimer(&timer);
+    callback(&parameters);
+    asyncStopCallbackTimer(&timer, "event", callback);
+  }
+}
+
+#ifdef ASYNC_EVENT_USE_EVENTFD
+static SignalEntry *
+takePendingSignals (AsyncEvent *event) {
+  SignalEntry *signals = __atomic_exchange_n(&event->pendingSignals, NULL, __ATOMIC_ACQUIRE);
+  SignalEntry *ordered = NULL;
+
+  /* they were pushed in reverse order */
+  while (signals) {
+    SignalEntry *signal = signals;
+    signals = signal->next;
+
+    signal->next = ordered;
+    ordered = signal;
+  }
+
+  return ordered;
+}
+
+static void
+deallocateSignalEntries (SignalEntry *signals) {
+  while (signals) {
+    SignalEntry *signal = signals;
+    signals = signal->next;
+    free(signal);
+  }
+}
+
+static void
+deallocateEvent (AsyncEvent *event) {
+  closeFileDescriptor(event->monitorDescriptor);
+  deallocateSignalEntries(takePendingSignals(event));
+
+  logSymbol(LOG_CATEGORY(ASYNC_EVENTS), event->callback, "event removed");
+  free(event);
+}
+
+ASYNC_ALARM_CALLBACK(asyncDeallocateDiscardedEvent) {
+  deallocateEvent(parameters->data);
+}
+
+ASYNC_MONITOR_CALLBACK(asyncMonitorEventDescriptor) {
+  AsyncEvent *event = parameters->data;
+  uint64_t count;
+
+  if (read(event->monitorDescriptor, &count, sizeof(count)) == -1) {
+    if ((errno != EAGAIN) && (errno != EINTR)) {
+      logSystemError("eventfd read");
+      return 0;
+    }
+  }
+
+  {
+    SignalEntry *signals = takePendingSignals(event);
+
+    event->active = 1;
+
+    while (signals) {
+      SignalEntry *signal = signals;
+      signals = signal->next;
+
+      if (!event->discard) invokeEventCallback(event, signal->data);
+      free(signal);
+    }
+
+    event->active = 0;
+
+    if (event->discard) {
+      /* The monitor is only removed after this callback returns, and its
+       * descriptor mustn't be closed (and possibly reused) before then.
+       */
+      if (!asyncNewRelativeAlarm(NULL, 0, asyncDeallocateDiscardedEvent, event)) {
+        deallocateEvent(event);
+      }
+
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int
+asyncSignalEvent (AsyncEvent *event, void *data) {
+  SignalEntry *signal;
+
+  if ((signal = malloc(sizeof(*signal)))) {
+    signal->data = data;
+    signal->next = __atomic_load_n(&event->pendingSignals, __ATOMIC_RELAXED);
+
+    while (!__atomic_compare_exchange_n(&event->pendingSignals, &signal->next, signal,
+                                        1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    if (!signal->next) {
+      static const uint64_t count = 1;
+
+      if (write(event->monitorDescriptor, &count, sizeof(count)) == -1) {
+        if (errno != EAGAIN) {
+          logSystemError("eventfd write");
+          return 0;
+        }
+      }
+    }
+
+    return 1;
+  } else {
+    logMallocError();
+  }
+
+  return 0;
+}
+
+AsyncEvent *
+asyncNewEvent (AsyncEventCallback *callback, void *data) {
+  AsyncEvent *event;
+
+  if ((event = malloc(sizeof(*event)))) {
+    memset(event, 0, sizeof(*event));
+    event->callback = callback;
+    event->data = data;
+
+    event->pendingSignals = NULL;
+    event->active = 0;
+    event->discard = 0;
+
+    if ((event->monitorDescriptor = eventfd(0, (EFD_CLOEXEC | EFD_NONBLOCK))) != -1) {
+      if (asyncMonitorFileInput(&event->monitorHandle, event->monitorDescriptor,
+                                asyncMonitorEventDescriptor, event)) {
+        logSymbol(LOG_CATEGORY(ASYNC_EVENTS), event->callback, "event added");
+        return event;
+      }
+
+      closeFileDescriptor(event->monitorDescriptor);
+    } else {
+      logSystemError("eventfd");
+    }
+
+    free(event);
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+void
+asyncDiscardEvent (AsyncEvent *event) {
+  asyncCancelRequest(event->monitorHandle);
+
+  if (event->active) {
+    event->discard = 1;
+  } else {
+    deallocateEvent(event);
+  }
+}
+
+#else /* ASYNC_EVENT_USE_EVENTFD */
 ASYNC_MONITOR_CALLBACK(asyncMonitorEventPipe) {
   AsyncEvent *event = parameters->data;
   void *data;
@@ -54,18 +257,7 @@ ASYNC_MONITOR_CALLBACK(asyncMonitorEventPipe) {
     LeaveCriticalSection(&event->criticalSection);
 #endif /* __MINGW32__ */
 
-    {
-      AsyncEventCallback *callback = event->callback;
-
-      const AsyncEventCallbackParameters parameters = {
-        .eventData = event->data,
-        .signalData = data
-      };
-
-      logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "event starting");
-      if (callback) callback(&parameters);
-    }
-
+    invokeEventCallback(event, data);
     return 1;
   }
 
@@ -157,4 +349,5 @@ asyncDiscardEvent (AsyncEvent *event) {
   logSymbol(LOG_CATEGORY(ASYNC_EVENTS), event->callback, "event removed");
   free(event);
 }
+#endif /* ASYNC_EVENT_USE_EVENTFD */
 
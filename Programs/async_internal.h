@@ -21,6 +21,8 @@
 
 #include "async.h"
 #include "queue.h"
+#include "log.h"
+#include "timing.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +52,8 @@ typedef struct {
   AsyncTaskData *taskData;
   AsyncIoData *ioData;
   AsyncSignalData *signalData;
+
+  unsigned long long int nestedWaitTime;
 } AsyncThreadSpecificData;
 
 extern AsyncThreadSpecificData *asyncGetThreadSpecificData (void);
@@ -69,6 +73,29 @@ typedef struct {
   void (*cancelRequest) (Element *element);
 } AsyncQueueMethods;
 
+typedef struct {
+  TimeValue start;
+  unsigned long long int nestedWaitTime;
+  unsigned started:1;
+} AsyncCallbackTimer;
+
+extern unsigned long long int asyncGetNestedWaitTime (void);
+extern void asyncRecordCallbackTime (const AsyncCallbackTimer *timer, const char *kind, void *callback);
+extern void asyncRecordNestedWaitTime (const AsyncCallbackTimer *timer);
+
+static inline void
+asyncStartCallbackTimer (AsyncCallbackTimer *timer) {
+  if ((timer->started = !!LOG_CATEGORY_FLAG(ASYNC_PROFILE))) {
+    timer->nestedWaitTime = asyncGetNestedWaitTime();
+    getMonotonicTime(&timer->start);
+  }
+}
+
+static inline void
+asyncStopCallbackTimer (const AsyncCallbackTimer *timer, const char *kind, void *callback) {
+  if (timer->started) asyncRecordCallbackTime(timer, kind, callback);
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -39,6 +39,14 @@
 
 typedef HANDLE MonitorEntry;
 
+#elif defined(HAVE_SYS_EPOLL_H)
+#define ASYNC_CAN_MONITOR_IO
+#define ASYNC_USE_EPOLL
+
+#include <sys/epoll.h>
+#include <sys/stat.h>
+typedef struct epoll_event MonitorEntry;
+
 #elif defined(HAVE_SYS_POLL_H)
 #define ASYNC_CAN_MONITOR_IO
 
@@ -71,6 +79,10 @@ typedef struct {
 
 typedef struct FunctionEntryStruct FunctionEntry;
 
+#ifdef ASYNC_USE_EPOLL
+typedef struct DescriptorEntryStruct DescriptorEntry;
+#endif /* ASYNC_USE_EPOLL */
+
 typedef struct {
   AsyncMonitorCallback *callback;
 } MonitorExtension;
@@ -129,6 +141,16 @@ struct FunctionEntryStruct {
     OVERLAPPED overlapped;
   } windows;
 
+#elif defined(ASYNC_USE_EPOLL)
+  struct {
+    uint32_t events;
+    Element *element;
+    DescriptorEntry *descriptor;
+    FunctionEntry *next;
+    FunctionEntry *nextReady;
+    unsigned ready:1;
+  } epoll;
+
 #elif defined(HAVE_SYS_POLL_H)
   struct {
     short int events;
@@ -152,14 +174,51 @@ typedef struct {
   unsigned int count;
 } MonitorGroup;
 
+#ifdef ASYNC_USE_EPOLL
+struct DescriptorEntryStruct {
+  AsyncIoData *ioData;
+  FileDescriptor fileDescriptor;
+  FunctionEntry *functions;
+
+  uint32_t generation;
+  dev_t device;
+  ino_t inode;
+
+  uint32_t events;
+  unsigned unpollable:1;
+  unsigned orphaned:1;
+};
+#endif /* ASYNC_USE_EPOLL */
+
 struct AsyncIoDataStruct {
   Queue *functionQueue;
+
+#ifdef ASYNC_USE_EPOLL
+  struct {
+    int descriptor;
+
+    DescriptorEntry **descriptors;
+    unsigned int size;
+
+    FunctionEntry *firstReady;
+    FunctionEntry *lastReady;
+    unsigned servedReady:1;
+
+    uint32_t generation;
+  } epoll;
+#endif /* ASYNC_USE_EPOLL */
 };
 
 void
 asyncDeallocateIoData (AsyncIoData *iod) {
   if (iod) {
     if (iod->functionQueue) deallocateQueue(iod->functionQueue);
+
+#ifdef ASYNC_USE_EPOLL
+    if (iod->epoll.descriptors) free(iod->epoll.descriptors);
+    if (iod->epoll.descriptor != -1) close(iod->epoll.descriptor);
+#endif /* ASYNC_USE_EPOLL */
+
     free(iod);
   }
 }
@@ -179,6 +238,16 @@ getIoData (void) {
 
     memset(iod, 0, sizeof(*iod));
     iod->functionQueue = NULL;
+
+#ifdef ASYNC_USE_EPOLL
+    iod->epoll.descriptor = -1;
+    iod->epoll.descriptors = NULL;
+    iod->epoll.size = 0;
+    iod->epoll.firstReady = NULL;
+    iod->epoll.lastReady = NULL;
+    iod->epoll.servedReady = 0;
+    iod->epoll.generation = 0;
+#endif /* ASYNC_USE_EPOLL */
     tsd->ioData = iod;
   }
 
@@ -350,7 +419,23 @@ cancelWindowsTransferOperation (OperationEntry *operation) {
 
 #else /* __MINGW32__ */
 
-#ifdef HAVE_SYS_POLL_H
+#if defined(ASYNC_USE_EPOLL)
+static void
+beginUnixInputFunction (FunctionEntry *function) {
+  function->epoll.events = EPOLLIN;
+}
+
+static void
+beginUnixOutputFunction (FunctionEntry *function) {
+  function->epoll.events = EPOLLOUT;
+}
+
+static void
+beginUnixAlertFunction (FunctionEntry *function) {
+  function->epoll.events = EPOLLPRI;
+}
+
+#elif defined(HAVE_SYS_POLL_H)
 static void
 prepareMonitors (void) {
 }
@@ -555,10 +640,18 @@ finishUnixWrite (OperationEntry *operation) {
 #endif /* __MINGW32__ */
 
 #ifdef ASYNC_CAN_MONITOR_IO
+#ifdef ASYNC_USE_EPOLL
+static void detachEpollFunction (FunctionEntry *function);
+#endif /* ASYNC_USE_EPOLL */
+
 static void
 deallocateFunctionEntry (void *item, void *data) {
   FunctionEntry *function = item;
 
+#ifdef ASYNC_USE_EPOLL
+  detachEpollFunction(function);
+#endif /* ASYNC_USE_EPOLL */
+
   if (function->operations) deallocateQueue(function->operations);
   if (function->methods->endFunction) function->methods->endFunction(function);
   free(function);
@@ -589,7 +682,13 @@ invokeMonitorCallback (OperationEntry *operation) {
       .data = operation->data
     };
 
-    if (callback(&parameters)) return 1;
+    AsyncCallbackTimer timer;
+    int result;
+
+    asyncStartCallbackTimer(&timer);
+    result = callback(&parameters);
+    asyncStopCallbackTimer(&timer, "monitor", callback);
+    if (result) return 1;
   }
 
   return 0;
@@ -615,7 +714,11 @@ invokeInputCallback (OperationEntry *operation) {
       .end = extension->direction.input.end
     };
 
+    AsyncCallbackTimer timer;
+
+    asyncStartCallbackTimer(&timer);
     count = callback(&parameters);
+    asyncStopCallbackTimer(&timer, "input", callback);
   }
 
   if (operation->error) return 0;
@@ -651,7 +754,11 @@ invokeOutputCallback (OperationEntry *operation) {
       .error = operation->error
     };
 
+    AsyncCallbackTimer timer;
+
+    asyncStartCallbackTimer(&timer);
     callback(&parameters);
+    asyncStopCallbackTimer(&timer, "output", callback);
   }
 
   return 0;
@@ -687,6 +794,477 @@ finishOperation (OperationEntry *operation) {
   }
 }
 
+#ifdef ASYNC_USE_EPOLL
+/* With epoll, each file descriptor is registered with the kernel once (all of
+ * the functions which share it are merged into a single descriptor entry) and
+ * its registration is only changed when the union of the events its functions
+ * are waiting for changes. The kernel then reports just the descriptors which
+ * are ready, so the cost of a wait no longer depends on how many are idle.
+ *
+ * A registration is tagged with its descriptor entry's generation as well as
+ * with the file descriptor number, and a descriptor entry also remembers which
+ * file it was created for, so that a file descriptor which is closed (without
+ * its functions first being cancelled) and then reused doesn't end up sharing
+ * the stale entry.
+ */
+
+static int
+isWaitingFunction (const FunctionEntry *function) {
+  const OperationEntry *operation = getActiveOperation(function);
+
+  return operation && !operation->active && !operation->finished;
+}
+
+static void
+addReadyFunction (FunctionEntry *function) {
+  if (!function->epoll.ready) {
+    AsyncIoData *iod = function->epoll.descriptor->ioData;
+
+    function->epoll.ready = 1;
+    function->epoll.nextReady = NULL;
+
+    if (iod->epoll.lastReady) {
+      iod->epoll.lastReady->epoll.nextReady = function;
+    } else {
+      iod->epoll.firstReady = function;
+    }
+
+    iod->epoll.lastReady = function;
+  }
+}
+
+static void
+removeReadyFunction (FunctionEntry *function) {
+  if (function->epoll.ready) {
+    AsyncIoData *iod = function->epoll.descriptor->ioData;
+    FunctionEntry **next = &iod->epoll.firstReady;
+    FunctionEntry *previous = NULL;
+
+    while (*next != function) {
+      previous = *next;
+      next = &previous->epoll.nextReady;
+    }
+
+    *next = function->epoll.nextReady;
+    if (iod->epoll.lastReady == function) iod->epoll.lastReady = previous;
+    function->epoll.ready = 0;
+  }
+}
+
+static FunctionEntry *
+takeReadyFunction (AsyncIoData *iod) {
+  FunctionEntry *function;
+
+  while ((function = iod->epoll.firstReady)) {
+    if (!(iod->epoll.firstReady = function->epoll.nextReady)) iod->epoll.lastReady = NULL;
+    function->epoll.ready = 0;
+
+    {
+      OperationEntry *operation = getActiveOperation(function);
+
+      if (operation && !operation->active) {
+        if (operation->finished) return function;
+
+        if (function->epoll.descriptor->unpollable) {
+          operation->error = 0;
+          return function;
+        }
+      }
+    }
+  }
+
+  return NULL;
+}
+
+static int
+controlDescriptor (DescriptorEntry *descriptor, uint32_t events) {
+  struct epoll_event event = {
+    .events = events,
+    .data.u64 = ((uint64_t)descriptor->generation << 32) | (uint32_t)descriptor->fileDescriptor
+  };
+
+  int operation = !events? EPOLL_CTL_DEL:
+                  descriptor->events? EPOLL_CTL_MOD:
+                  EPOLL_CTL_ADD;
+
+  int retry = 1;
+
+  while (epoll_ctl(descriptor->ioData->epoll.descriptor, operation,
+                   descriptor->fileDescriptor, &event) == -1) {
+    if (retry) {
+      retry = 0;
+
+      /* Closing a file descriptor implicitly removes it from the epoll set,
+       * and it may then be reopened, so our notion of whether or not it's
+       * registered can be stale.
+       */
+      if (errno == ENOENT) {
+        if (operation == EPOLL_CTL_DEL) return 1;
+        if (operation == EPOLL_CTL_MOD) {
+          operation = EPOLL_CTL_ADD;
+          continue;
+        }
+      } else if (errno == EEXIST) {
+        if (operation == EPOLL_CTL_ADD) {
+          operation = EPOLL_CTL_MOD;
+          continue;
+        }
+      }
+    }
+
+    /* the file descriptor has already been closed */
+    if ((errno == EBADF) && (operation == EPOLL_CTL_DEL)) return 1;
+
+    /* regular files and directories can't be monitored via epoll */
+    if (errno != EPERM) logSystemError("epoll_ctl");
+    return 0;
+  }
+
+  return 1;
+}
+
+static void
+updateDescriptorEvents (DescriptorEntry *descriptor) {
+  const FunctionEntry *function;
+
+  /* its file descriptor now refers to another file */
+  if (descriptor->orphaned) return;
+
+  if (!descriptor->unpollable) {
+    uint32_t events = 0;
+
+    for (function=descriptor->functions; function; function=function->epoll.next) {
+      if (isWaitingFunction(function)) events |= function->epoll.events;
+    }
+
+    if (events == descriptor->events) return;
+
+    if (controlDescriptor(descriptor, events)) {
+      descriptor->events = events;
+      return;
+    }
+
+    if (descriptor->events) {
+      epoll_ctl(descriptor->ioData->epoll.descriptor, EPOLL_CTL_DEL,
+                descriptor->fileDescriptor, NULL);
+    }
+
+    descriptor->events = 0;
+    descriptor->unpollable = 1;
+  }
+
+  /* like poll, treat a descriptor which can't be monitored as always ready */
+  for (function=descriptor->functions; function; function=function->epoll.next) {
+    if (isWaitingFunction(function)) addReadyFunction((FunctionEntry *)function);
+  }
+}
+
+static void
+updateEpollFunction (FunctionEntry *function) {
+  OperationEntry *operation = getActiveOperation(function);
+
+  if (operation && !operation->active && operation->finished) {
+    addReadyFunction(function);
+  }
+
+  updateDescriptorEvents(function->epoll.descriptor);
+}
+
+static FunctionEntry *
+getReadyFunction (DescriptorEntry *descriptor, uint32_t events) {
+  FunctionEntry **previous = &descriptor->functions;
+  FunctionEntry *function;
+
+  while ((function = *previous)) {
+    if (isWaitingFunction(function)) {
+      if (events & (function->epoll.events | EPOLLERR | EPOLLHUP)) {
+        OperationEntry *operation = getActiveOperation(function);
+
+        if (events & function->epoll.events) {
+          operation->error = 0;
+        } else if (events & EPOLLHUP) {
+          operation->error = ENODEV;
+        } else {
+          operation->error = EIO;
+        }
+
+        /* give the other functions on this descriptor the next turn */
+        if (function->epoll.next) {
+          *previous = function->epoll.next;
+          while (*previous) previous = &(*previous)->epoll.next;
+          *previous = function;
+          function->epoll.next = NULL;
+        }
+
+        return function;
+      }
+    }
+
+    previous = &function->epoll.next;
+  }
+
+  return NULL;
+}
+
+static DescriptorEntry *
+getDescriptorEntry (AsyncIoData *iod, FileDescriptor fileDescriptor, const struct stat *status) {
+  DescriptorEntry *descriptor;
+
+  if ((unsigned int)fileDescriptor >= iod->epoll.size) return NULL;
+  if (!(descriptor = iod->epoll.descriptors[fileDescriptor])) return NULL;
+
+  if ((descriptor->device != status->st_dev) || (descriptor->inode != status->st_ino)) {
+    /* The file descriptor was closed and then reused. The functions still
+     * on the old entry can't be served anymore - they'll just be cancelled.
+     */
+    descriptor->orphaned = 1;
+    descriptor->events = 0;
+    iod->epoll.descriptors[fileDescriptor] = NULL;
+    return NULL;
+  }
+
+  return descriptor;
+}
+
+static int
+attachEpollFunction (AsyncIoData *iod, FunctionEntry *function) {
+  FileDescriptor fileDescriptor = function->fileDescriptor;
+  DescriptorEntry *descriptor;
+
+  function->epoll.descriptor = NULL;
+  function->epoll.next = NULL;
+  function->epoll.nextReady = NULL;
+  function->epoll.ready = 0;
+
+  if (fileDescriptor < 0) {
+    logMessage(LOG_WARNING, "invalid file descriptor: %d", fileDescriptor);
+    return 0;
+  }
+
+  if (iod->epoll.descriptor == -1) {
+    if ((iod->epoll.descriptor = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+      logSystemError("epoll_create1");
+      return 0;
+    }
+  }
+
+  if ((unsigned int)fileDescriptor >= iod->epoll.size) {
+    unsigned int size = MAX(iod->epoll.size, 0X10);
+    DescriptorEntry **descriptors;
+
+    while ((unsigned int)fileDescriptor >= size) size <<= 1;
+
+    if (!(descriptors = realloc(iod->epoll.descriptors, ARRAY_SIZE(descriptors, size)))) {
+      logMallocError();
+      return 0;
+    }
+
+    memset(&descriptors[iod->epoll.size], 0,
+           ARRAY_SIZE(descriptors, (size - iod->epoll.size)));
+
+    iod->epoll.descriptors = descriptors;
+    iod->epoll.size = size;
+  }
+
+  {
+    struct stat status;
+
+    if (fstat(fileDescriptor, &status) == -1) {
+      logSystemError("fstat");
+      return 0;
+    }
+
+    if (!(descriptor = getDescriptorEntry(iod, fileDescriptor, &status))) {
+      if (!(descriptor = malloc(sizeof(*descriptor)))) {
+        logMallocError();
+        return 0;
+      }
+
+      memset(descriptor, 0, sizeof(*descriptor));
+      descriptor->ioData = iod;
+      descriptor->fileDescriptor = fileDescriptor;
+      descriptor->functions = NULL;
+
+      descriptor->generation = ++iod->epoll.generation;
+      descriptor->device = status.st_dev;
+      descriptor->inode = status.st_ino;
+
+      descriptor->events = 0;
+      descriptor->unpollable = 0;
+      descriptor->orphaned = 0;
+
+      iod->epoll.descriptors[fileDescriptor] = descriptor;
+    }
+  }
+
+  function->epoll.next = descriptor->functions;
+  descriptor->functions = function;
+  function->epoll.descriptor = descriptor;
+  return 1;
+}
+
+static void
+detachEpollFunction (FunctionEntry *function) {
+  DescriptorEntry *descriptor = function->epoll.descriptor;
+
+  if (descriptor) {
+    FunctionEntry **previous = &descriptor->functions;
+
+    removeReadyFunction(function);
+    while (*previous != function) previous = &(*previous)->epoll.next;
+    *previous = function->epoll.next;
+    function->epoll.descriptor = NULL;
+
+    if (descriptor->functions) {
+      updateDescriptorEvents(descriptor);
+    } else {
+      AsyncIoData *iod = descriptor->ioData;
+
+      if (!descriptor->orphaned) {
+        if (descriptor->events) controlDescriptor(descriptor, 0);
+        iod->epoll.descriptors[descriptor->fileDescriptor] = NULL;
+      }
+
+      free(descriptor);
+    }
+  }
+}
+
+static Element *
+findFunctionElement (Queue *functions, FileDescriptor fileDescriptor, const FunctionMethods *methods) {
+  AsyncIoData *iod = getIoData();
+
+  if ((fileDescriptor >= 0) && ((unsigned int)fileDescriptor < iod->epoll.size)) {
+    const DescriptorEntry *descriptor;
+    struct stat status;
+
+    if (fstat(fileDescriptor, &status) == -1) return NULL;
+
+    if ((descriptor = getDescriptorEntry(iod, fileDescriptor, &status))) {
+      const FunctionEntry *function;
+
+      for (function=descriptor->functions; function; function=function->epoll.next) {
+        if (function->methods == methods) return function->epoll.element;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+#else /* ASYNC_USE_EPOLL */
+static int
+testFunctionEntry (const void *item, void *data) {
+  const FunctionEntry *function = item;
+  const FunctionKey *key = data;
+  return (function->fileDescriptor == key->fileDescriptor) &&
+         (function->methods == key->methods);
+}
+
+static Element *
+findFunctionElement (Queue *functions, FileDescriptor fileDescriptor, const FunctionMethods *methods) {
+  FunctionKey key = {
+    .fileDescriptor = fileDescriptor,
+    .methods = methods
+  };
+
+  return findElement(functions, testFunctionEntry, &key);
+}
+#endif /* ASYNC_USE_EPOLL */
+
+static void
+executeFunction (Element *functionElement) {
+  FunctionEntry *function = getElementItem(functionElement);
+  Element *operationElement = getActiveOperationElement(function);
+  OperationEntry *operation = getElementItem(operationElement);
+
+  if (!operation->finished) finishOperation(operation);
+
+  operation->active = 1;
+  if (!function->methods->invokeCallback(operation)) operation->cancel = 1;
+  operation->active = 0;
+
+  if (operation->cancel) {
+    deleteElement(operationElement);
+  } else {
+    operation->error = 0;
+  }
+
+  if ((operationElement = getActiveOperationElement(function))) {
+    operation = getElementItem(operationElement);
+    if (!operation->finished) startOperation(operation);
+    requeueElement(functionElement);
+
+#ifdef ASYNC_USE_EPOLL
+    updateEpollFunction(function);
+#endif /* ASYNC_USE_EPOLL */
+  } else {
+    deleteElement(functionElement);
+  }
+}
+
+#ifdef ASYNC_USE_EPOLL
+int
+asyncExecuteIoCallback (AsyncIoData *iod, long int timeout) {
+  if (iod) {
+    Queue *functions = iod->functionQueue;
+
+    if (functions && getQueueSize(functions)) {
+      FunctionEntry *function = NULL;
+      int servedReady = 0;
+
+      /* Take turns with the kernel so that a descriptor on the ready list
+       * which is always ready (e.g. a regular file) can't starve the others,
+       * and vice versa. The kernel isn't waited for while anything is ready.
+       */
+      if (!iod->epoll.servedReady) {
+        if ((function = takeReadyFunction(iod))) servedReady = 1;
+      }
+
+      if (!function && (iod->epoll.descriptor != -1)) {
+        struct epoll_event event;
+        int result = epoll_wait(iod->epoll.descriptor, &event, 1,
+                                (iod->epoll.firstReady? 0: timeout));
+
+        if (result > 0) {
+          FileDescriptor fileDescriptor = event.data.u64 & UINT32_MAX;
+          uint32_t generation = event.data.u64 >> 32;
+          DescriptorEntry *descriptor = ((unsigned int)fileDescriptor < iod->epoll.size)?
+                                        iod->epoll.descriptors[fileDescriptor]: NULL;
+
+          if (!descriptor || (descriptor->generation != generation)) {
+            /* a registration which outlived its descriptor entry */
+          } else if (!(function = getReadyFunction(descriptor, event.events))) {
+            /* All of its functions are busy (e.g. a nested wait within one
+             * of their callbacks) so stop listening until one of them is done.
+             */
+            updateDescriptorEvents(descriptor);
+          }
+        } else if (result == -1) {
+          if (errno != EINTR) logSystemError("epoll_wait");
+        }
+      }
+
+      if (!function) {
+        if ((function = takeReadyFunction(iod))) servedReady = 1;
+      }
+
+      iod->epoll.servedReady = servedReady;
+
+      if (function) {
+        executeFunction(function->epoll.element);
+        return 1;
+      }
+
+      return 0;
+    }
+  }
+
+  approximateDelay(timeout);
+  return 0;
+}
+
+#else /* ASYNC_USE_EPOLL */
 static int
 addFunctionMonitor (void *item, void *data) {
   const FunctionEntry *function = item;
@@ -737,7 +1315,6 @@ asyncExecuteIoCallback (AsyncIoData *iod, long int timeout) {
         .count = 0
       };
 
-      int executed = 0;
       Element *functionElement = processQueue(functions, addFunctionMonitor, &monitors);
 
       if (!functionElement) {
@@ -749,39 +1326,18 @@ asyncExecuteIoCallback (AsyncIoData *iod, long int timeout) {
       }
 
       if (functionElement) {
-        FunctionEntry *function = getElementItem(functionElement);
-        Element *operationElement = getActiveOperationElement(function);
-        OperationEntry *operation = getElementItem(operationElement);
-
-        if (!operation->finished) finishOperation(operation);
-
-        operation->active = 1;
-        if (!function->methods->invokeCallback(operation)) operation->cancel = 1;
-        operation->active = 0;
-        executed = 1;
-
-        if (operation->cancel) {
-          deleteElement(operationElement);
-        } else {
-          operation->error = 0;
-        }
-
-        if ((operationElement = getActiveOperationElement(function))) {
-          operation = getElementItem(operationElement);
-          if (!operation->finished) startOperation(operation);
-          requeueElement(functionElement);
-        } else {
-          deleteElement(functionElement);
-        }
+        executeFunction(functionElement);
+        return 1;
       }
 
-      return executed;
+      return 0;
     }
   }
 
   approximateDelay(timeout);
   return 0;
 }
+#endif /* ASYNC_USE_EPOLL */
 
 static void
 deallocateOperationEntry (void *item, void *data) {
@@ -809,7 +1365,11 @@ cancelOperation (Element *operationElement) {
     }
 
     if (getQueueSize(function->operations) == 1) {
+#ifdef ASYNC_USE_EPOLL
+      deleteElement(function->epoll.element);
+#else /* ASYNC_USE_EPOLL */
       deleteElement(findElementWithItem(getFunctionQueue(0), function));
+#endif /* ASYNC_USE_EPOLL */
     } else {
       deleteElement(operationElement);
 
@@ -819,33 +1379,22 @@ cancelOperation (Element *operationElement) {
 
         if (!operation->finished) startOperation(operation);
       }
+
+#ifdef ASYNC_USE_EPOLL
+      updateEpollFunction(function);
+#endif /* ASYNC_USE_EPOLL */
     }
   }
 }
 
-static int
-testFunctionEntry (const void *item, void *data) {
-  const FunctionEntry *function = item;
-  const FunctionKey *key = data;
-  return (function->fileDescriptor == key->fileDescriptor) &&
-         (function->methods == key->methods);
-}
-
 static Element *
 getFunctionElement (FileDescriptor fileDescriptor, const FunctionMethods *methods, int create) {
   Queue *functions = getFunctionQueue(create);
 
   if (functions) {
     {
-      FunctionKey key = {
-        .fileDescriptor = fileDescriptor,
-        .methods = methods
-      };
-
-      {
-        Element *element = findElement(functions, testFunctionEntry, &key);
-        if (element) return element;
-      }
+      Element *element = findFunctionElement(functions, fileDescriptor, methods);
+      if (element) return element;
     }
 
     if (create) {
@@ -866,11 +1415,31 @@ getFunctionElement (FileDescriptor fileDescriptor, const FunctionMethods *method
 
           if (methods->beginFunction) methods->beginFunction(function);
 
+#ifdef ASYNC_USE_EPOLL
+          if (!attachEpollFunction(getIoData(), function)) {
+            if (methods->endFunction) methods->endFunction(function);
+            deallocateQueue(function->operations);
+            free(function);
+            return NULL;
+          }
+#endif /* ASYNC_USE_EPOLL */
+
           {
             Element *element = enqueueItem(functions, function);
-            if (element) return element;
+
+            if (element) {
+#ifdef ASYNC_USE_EPOLL
+              function->epoll.element = element;
+#endif /* ASYNC_USE_EPOLL */
+
+              return element;
+            }
           }
 
+#ifdef ASYNC_USE_EPOLL
+          detachEpollFunction(function);
+#endif /* ASYNC_USE_EPOLL */
+
           deallocateQueue(function->operations);
         }
 
@@ -914,6 +1483,11 @@ newOperation (
         operation->finished = 0;
 
         if (isFirstOperation) startOperation(operation);
+
+#ifdef ASYNC_USE_EPOLL
+        updateEpollFunction(function);
+#endif /* ASYNC_USE_EPOLL */
+
         return operationElement;
       }
 
@@ -0,0 +1,223 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "async_profile.h"
+#include "async_internal.h"
+#include "thread.h"
+#include "program.h"
+
+/* When the "profile" log category is enabled, the run time of every alarm,
+ * task, I/O, event, and signal callback is accumulated per callback address.
+ * The table is shared by all threads, and is only touched while profiling.
+ * The time a callback spends within a nested wait (e.g. asyncWait) isn't
+ * included in its run time - any callbacks run by that wait are profiled on
+ * their own.
+ */
+
+#define PROFILE_TABLE_SIZE 0X400
+
+typedef struct {
+  void *callback;
+  const char *kind;
+
+  unsigned long int calls;
+  unsigned long int slowCalls;
+  unsigned long long int totalTime;
+  unsigned long int maximumTime;
+} ProfileEntry;
+
+static CriticalSectionLock profileLock = CRITICAL_SECTION_LOCK_INITIALIZER;
+static ProfileEntry profileTable[PROFILE_TABLE_SIZE];
+static unsigned int profileCount = 0;
+static unsigned long int profileOverflows = 0;
+
+static void
+exitCallbackProfile (void *data) {
+  int profiled;
+
+  enterCriticalSection(&profileLock);
+    profiled = profileCount > 0;
+  leaveCriticalSection(&profileLock);
+
+  if (profiled) asyncLogCallbackProfile(20);
+}
+
+void
+asyncBeginCallbackProfile (void) {
+  onProgramExit("callback-profile", exitCallbackProfile, NULL);
+}
+
+static unsigned long int
+getTimerElapsed (const AsyncCallbackTimer *timer) {
+  TimeValue now;
+
+  getMonotonicTime(&now);
+  return ((now.seconds - timer->start.seconds) * USECS_PER_SEC)
+       + ((now.nanoseconds - timer->start.nanoseconds) / NSECS_PER_USEC);
+}
+
+unsigned long long int
+asyncGetNestedWaitTime (void) {
+  AsyncThreadSpecificData *tsd = asyncGetThreadSpecificData();
+
+  return tsd? tsd->nestedWaitTime: 0;
+}
+
+void
+asyncRecordNestedWaitTime (const AsyncCallbackTimer *timer) {
+  AsyncThreadSpecificData *tsd = asyncGetThreadSpecificData();
+
+  if (tsd) {
+    unsigned long long int elapsed = getTimerElapsed(timer);
+    unsigned long long int inner = tsd->nestedWaitTime - timer->nestedWaitTime;
+
+    /* the waits nested within this one have already been added */
+    if (elapsed > inner) tsd->nestedWaitTime += elapsed - inner;
+  }
+}
+
+static ProfileEntry *
+getProfileEntry (void *callback, const char *kind) {
+  unsigned int index = ((uintptr_t)callback >> 4) % PROFILE_TABLE_SIZE;
+  unsigned int probes = PROFILE_TABLE_SIZE;
+
+  while (probes--) {
+    ProfileEntry *entry = &profileTable[index];
+
+    if (!entry->callback) {
+      if (profileCount == (PROFILE_TABLE_SIZE / 4 * 3)) break;
+      profileCount += 1;
+
+      entry->callback = callback;
+      entry->kind = kind;
+      return entry;
+    }
+
+    if ((entry->callback == callback) && (entry->kind == kind)) return entry;
+    if (++index == PROFILE_TABLE_SIZE) index = 0;
+  }
+
+  profileOverflows += 1;
+  return NULL;
+}
+
+void
+asyncRecordCallbackTime (const AsyncCallbackTimer *timer, const char *kind, void *callback) {
+  unsigned long int microseconds = getTimerElapsed(timer);
+
+  {
+    unsigned long long int nested = asyncGetNestedWaitTime() - timer->nestedWaitTime;
+
+    microseconds = (microseconds > nested)? (microseconds - nested): 0;
+  }
+
+  if (microseconds >= (ASYNC_SLOW_CALLBACK_THRESHOLD * USECS_PER_MSEC)) {
+    logSymbol(LOG_WARNING, callback, "slow %s callback: %lu.%03lums",
+              kind, microseconds / USECS_PER_MSEC, microseconds % USECS_PER_MSEC);
+  }
+
+  enterCriticalSection(&profileLock);
+  {
+    ProfileEntry *entry = getProfileEntry(callback, kind);
+
+    if (entry) {
+      entry->calls += 1;
+      entry->totalTime += microseconds;
+      if (microseconds > entry->maximumTime) entry->maximumTime = microseconds;
+
+      if (microseconds >= (ASYNC_SLOW_CALLBACK_THRESHOLD * USECS_PER_MSEC)) {
+        entry->slowCalls += 1;
+      }
+    }
+  }
+  leaveCriticalSection(&profileLock);
+}
+
+static int
+sortProfileEntries (const void *element1, const void *element2) {
+  const ProfileEntry *entry1 = element1;
+  const ProfileEntry *entry2 = element2;
+
+  if (entry1->totalTime > entry2->totalTime) return -1;
+  if (entry1->totalTime < entry2->totalTime) return 1;
+  return 0;
+}
+
+void
+asyncLogCallbackProfile (unsigned int count) {
+  ProfileEntry *entries;
+  unsigned int entryCount = 0;
+  unsigned long int overflows;
+
+  if (!(entries = malloc(sizeof(profileTable)))) {
+    logMallocError();
+    return;
+  }
+
+  enterCriticalSection(&profileLock);
+  {
+    for (unsigned int index=0; index<PROFILE_TABLE_SIZE; index+=1) {
+      const ProfileEntry *entry = &profileTable[index];
+      if (entry->callback) entries[entryCount++] = *entry;
+    }
+
+    overflows = profileOverflows;
+  }
+  leaveCriticalSection(&profileLock);
+
+  if (entryCount) {
+    qsort(entries, entryCount, sizeof(*entries), sortProfileEntries);
+    if (count > entryCount) count = entryCount;
+
+    logMessage(LOG_NOTICE,
+               "callback profile: top %u of %u callbacks (%lu not tracked)",
+               count, entryCount, overflows);
+
+    for (unsigned int index=0; index<count; index+=1) {
+      const ProfileEntry *entry = &entries[index];
+
+      logSymbol(LOG_NOTICE, entry->callback,
+                "%s: calls:%lu total:%llums mean:%lluus max:%lums slow:%lu",
+                entry->kind, entry->calls,
+                entry->totalTime / USECS_PER_MSEC,
+                entry->totalTime / entry->calls,
+                entry->maximumTime / USECS_PER_MSEC,
+                entry->slowCalls);
+    }
+  } else if (!LOG_CATEGORY_FLAG(ASYNC_PROFILE)) {
+    logMessage(LOG_NOTICE, "callback profiling isn't enabled");
+  } else {
+    logMessage(LOG_NOTICE, "no callbacks have been profiled");
+  }
+
+  free(entries);
+}
+
+void
+asyncResetCallbackProfile (void) {
+  enterCriticalSection(&profileLock);
+    memset(profileTable, 0, sizeof(profileTable));
+    profileCount = 0;
+    profileOverflows = 0;
+  leaveCriticalSection(&profileLock);
+}
@@ -495,9 +495,13 @@ handlePendingSignal (const SignalEntry *sig) {
       .data = mon->data
     };
 
+    AsyncCallbackTimer timer;
+
     logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "signal %d starting", sig->number);
     mon->active = 1;
+    asyncStartCallbackTimer(&timer);
     if (!callback(&parameters)) mon->delete = 1;
+    asyncStopCallbackTimer(&timer, "signal", callback);
     mon->active = 0;
     logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "signal %d finished", sig->number);
     if (mon->delete) deleteMonitor(monitorElement);
@@ -139,7 +139,15 @@ asyncExecuteTaskCallback (AsyncTaskData *td) {
         AsyncTaskCallback *callback = task->callback;
 
         logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "task starting");
-        if (callback) callback(task->data);
+
+        if (callback) {
+          AsyncCallbackTimer timer;
+
+          asyncStartCallbackTimer(&timer);
+          callback(task->data);
+          asyncStopCallbackTimer(&timer, "task", callback);
+        }
+
         free(task);
         return 1;
       }
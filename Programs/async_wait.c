@@ -119,6 +119,15 @@ awaitAction (long int timeout) {
       .timeout = timeout
     };
 
+    AsyncCallbackTimer timer;
+
+    /* a wait within a callback isn't part of that callback's own run time */
+    if (wd->waitDepth) {
+      asyncStartCallbackTimer(&timer);
+    } else {
+      timer.started = 0;
+    }
+
     wd->waitDepth += 1;
     logMessage(LOG_CATEGORY(ASYNC_EVENTS),
                "begin: level %u: timeout %ld",
@@ -134,6 +143,7 @@ awaitAction (long int timeout) {
                wd->waitDepth, cbx->action);
 
     wd->waitDepth -= 1;
+    if (timer.started) asyncRecordNestedWaitTime(&timer);
   } else {
     logMessage(LOG_CATEGORY(ASYNC_EVENTS), "waiting: %ld", timeout);
     approximateDelay(timeout);
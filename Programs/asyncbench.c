@@ -0,0 +1,406 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* asyncbench measures the cost of the asynchronous event loop's primitives */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "options.h"
+#include "log.h"
+#include "parse.h"
+#include "timing.h"
+#include "async_alarm.h"
+#include "async_wait.h"
+#include "async_event.h"
+#include "queue.h"
+#include "thread.h"
+
+static char *opt_alarmCount;
+static char *opt_iterations;
+static char *opt_threads;
+static char *opt_benchmarks;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .letter = 'a',
+    .word = "alarms",
+    .argument = "count",
+    .setting.string = &opt_alarmCount,
+    .internal.setting = "5000",
+    .description = "The number of alarms to keep scheduled."
+  },
+
+  { .letter = 'i',
+    .word = "iterations",
+    .argument = "count",
+    .setting.string = &opt_iterations,
+    .internal.setting = "100000",
+    .description = "The number of times to perform each repeated operation."
+  },
+
+  { .letter = 't',
+    .word = "threads",
+    .argument = "count",
+    .setting.string = &opt_threads,
+    .internal.setting = "4",
+    .description = "The number of threads to run concurrently."
+  },
+
+  { .letter = 'b',
+    .word = "benchmarks",
+    .argument = "benchmark,...",
+    .setting.string = &opt_benchmarks,
+    .internal.setting = "alarm,queue,event",
+    .description = "The benchmarks (alarm, queue, event) to run."
+  },
+END_OPTION_TABLE
+
+#define MSECS_PER_MIN (MSECS_PER_SEC * SECS_PER_MIN)
+
+static int alarmCount;
+static int iterationCount;
+static int threadCount;
+
+typedef struct {
+  const char *name;
+  TimeValue start;
+} Measurement;
+
+static void
+startMeasurement (Measurement *measurement, const char *name) {
+  measurement->name = name;
+  getMonotonicTime(&measurement->start);
+}
+
+static void
+endMeasurement (const Measurement *measurement, unsigned long int count) {
+  TimeValue now;
+  double nanoseconds;
+
+  getMonotonicTime(&now);
+  nanoseconds = ((double)(now.seconds - measurement->start.seconds) * NSECS_PER_SEC)
+              + (now.nanoseconds - measurement->start.nanoseconds);
+
+  printf("%-16s %10lu %12.1f ns/op\n",
+         measurement->name, count, (count? nanoseconds / count: 0.0));
+}
+
+static int
+getRandomInteger (int minimum, int maximum) {
+  return minimum + (rand() % (maximum - minimum + 1));
+}
+
+static ASYNC_ALARM_CALLBACK(handleBenchmarkAlarm) {
+  unsigned long int *count = parameters->data;
+
+  *count += 1;
+}
+
+typedef struct {
+  const unsigned long int *count;
+  unsigned long int target;
+} CountParameters;
+
+static ASYNC_CONDITION_TESTER(testCount) {
+  const CountParameters *acp = data;
+
+  return *acp->count >= acp->target;
+}
+
+static int
+runAlarmBenchmark (void) {
+  int ok = 0;
+  AsyncHandle *handles;
+  unsigned long int fired = 0;
+  Measurement measurement;
+
+  if (!(handles = malloc(ARRAY_SIZE(handles, alarmCount)))) {
+    logMallocError();
+    return 0;
+  }
+
+  startMeasurement(&measurement, "alarm-add");
+  for (int index=0; index<alarmCount; index+=1) {
+    if (!asyncNewRelativeAlarm(&handles[index], getRandomInteger(MSECS_PER_SEC, MSECS_PER_MIN),
+                               handleBenchmarkAlarm, &fired)) {
+      while (index > 0) asyncCancelRequest(handles[--index]);
+      goto done;
+    }
+  }
+  endMeasurement(&measurement, alarmCount);
+
+  startMeasurement(&measurement, "alarm-reset");
+  for (int iteration=0; iteration<iterationCount; iteration+=1) {
+    asyncResetAlarmIn(handles[rand() % alarmCount],
+                      getRandomInteger(MSECS_PER_SEC, MSECS_PER_MIN));
+  }
+  endMeasurement(&measurement, iterationCount);
+
+  {
+    int count = MIN(alarmCount, iterationCount);
+    CountParameters acp = {
+      .count = &fired,
+      .target = count
+    };
+
+    for (int index=0; index<count; index+=1) {
+      asyncResetAlarmIn(handles[index], 0);
+      asyncResetAlarmInterval(handles[index], MSECS_PER_MIN);
+    }
+
+    startMeasurement(&measurement, "alarm-fire");
+    asyncAwaitCondition(MSECS_PER_MIN, testCount, &acp);
+    endMeasurement(&measurement, fired);
+  }
+
+  startMeasurement(&measurement, "alarm-cancel");
+  for (int index=0; index<alarmCount; index+=1) {
+    asyncCancelRequest(handles[index]);
+  }
+  endMeasurement(&measurement, alarmCount);
+
+  startMeasurement(&measurement, "alarm-churn");
+  for (int iteration=0; iteration<iterationCount; iteration+=1) {
+    AsyncHandle handle;
+
+    if (asyncNewRelativeAlarm(&handle, MSECS_PER_MIN, handleBenchmarkAlarm, &fired)) {
+      asyncCancelRequest(handle);
+    }
+  }
+  endMeasurement(&measurement, iterationCount);
+
+  ok = 1;
+done:
+  free(handles);
+  return ok;
+}
+
+#define QUEUE_BENCHMARK_DEPTH 0X10
+
+static THREAD_FUNCTION(runQueueThread) {
+  Queue *queue = newQueue(NULL, NULL);
+
+  if (queue) {
+    for (int iteration=0; iteration<iterationCount; iteration+=1) {
+      for (int index=0; index<QUEUE_BENCHMARK_DEPTH; index+=1) {
+        enqueueItem(queue, queue);
+      }
+
+      while (dequeueItem(queue));
+    }
+
+    deallocateQueue(queue);
+  }
+
+  return NULL;
+}
+
+static void
+logQueueStatistics (const QueueStatistics *before) {
+  QueueStatistics after;
+
+  getQueueStatistics(&after);
+  printf("queue-pool: slabs=%lu elements=%lu pooled=%lu taken=%lu returned=%lu locks=%lu contended=%lu\n",
+         after.slabAllocations - before->slabAllocations,
+         after.elementsAllocated, after.elementsPooled,
+         after.elementsTaken - before->elementsTaken,
+         after.elementsReturned - before->elementsReturned,
+         after.lockAcquisitions - before->lockAcquisitions,
+         after.lockContentions - before->lockContentions);
+}
+
+static int
+runQueueBenchmark (void) {
+  QueueStatistics statistics;
+  Measurement measurement;
+  unsigned long int count = (unsigned long int)iterationCount * QUEUE_BENCHMARK_DEPTH;
+
+  getQueueStatistics(&statistics);
+
+  startMeasurement(&measurement, "queue-local");
+  runQueueThread(NULL);
+  endMeasurement(&measurement, count);
+  logQueueStatistics(&statistics);
+
+#ifdef GOT_PTHREADS
+  {
+    pthread_t threads[threadCount];
+    int started = 0;
+
+    getQueueStatistics(&statistics);
+    startMeasurement(&measurement, "queue-threads");
+
+    while (started < threadCount) {
+      if (createThread("asyncbench-queue", &threads[started], NULL, runQueueThread, NULL)) break;
+      started += 1;
+    }
+
+    for (int index=0; index<started; index+=1) {
+      pthread_join(threads[index], NULL);
+    }
+
+    endMeasurement(&measurement, count * started);
+    logQueueStatistics(&statistics);
+    if (started < threadCount) return 0;
+  }
+#endif /* GOT_PTHREADS */
+
+  return 1;
+}
+
+#ifdef GOT_PTHREADS
+static ASYNC_EVENT_CALLBACK(handleBenchmarkEvent) {
+  unsigned long int *count = parameters->eventData;
+
+  *count += 1;
+}
+
+static THREAD_FUNCTION(runEventThread) {
+  AsyncEvent *event = argument;
+
+  for (int iteration=0; iteration<iterationCount; iteration+=1) {
+    if (!asyncSignalEvent(event, NULL)) break;
+  }
+
+  return NULL;
+}
+
+static int
+runEventBenchmark (void) {
+  int ok = 0;
+  unsigned long int received = 0;
+  AsyncEvent *event = asyncNewEvent(handleBenchmarkEvent, &received);
+
+  if (event) {
+    pthread_t threads[threadCount];
+    int started = 0;
+    Measurement measurement;
+
+    startMeasurement(&measurement, "event-signal");
+
+    while (started < threadCount) {
+      if (createThread("asyncbench-event", &threads[started], NULL, runEventThread, event)) break;
+      started += 1;
+    }
+
+    {
+      CountParameters acp = {
+        .count = &received,
+        .target = (unsigned long int)iterationCount * started
+      };
+
+      asyncAwaitCondition((MSECS_PER_MIN * 10), testCount, &acp);
+    }
+
+    endMeasurement(&measurement, received);
+
+    for (int index=0; index<started; index+=1) {
+      pthread_join(threads[index], NULL);
+    }
+
+    asyncDiscardEvent(event);
+    ok = started == threadCount;
+  }
+
+  return ok;
+}
+#endif /* GOT_PTHREADS */
+
+typedef struct {
+  const char *name;
+  int (*run) (void);
+} BenchmarkEntry;
+
+static const BenchmarkEntry benchmarkTable[] = {
+  { .name = "alarm",
+    .run = runAlarmBenchmark
+  },
+
+  { .name = "queue",
+    .run = runQueueBenchmark
+  },
+
+#ifdef GOT_PTHREADS
+  { .name = "event",
+    .run = runEventBenchmark
+  },
+#endif /* GOT_PTHREADS */
+};
+
+static const BenchmarkEntry *
+getBenchmark (const char *name) {
+  for (unsigned int index=0; index<ARRAY_COUNT(benchmarkTable); index+=1) {
+    const BenchmarkEntry *benchmark = &benchmarkTable[index];
+    if (strcmp(name, benchmark->name) == 0) return benchmark;
+  }
+
+  logMessage(LOG_ERR, "unknown benchmark: %s", name);
+  return NULL;
+}
+
+static int
+parseIntegerOption (int *value, const char *string, const char *name, int minimum, int maximum) {
+  if (validateInteger(value, string, &minimum, &maximum)) return 1;
+  logMessage(LOG_ERR, "invalid %s: %s", name, string);
+  return 0;
+}
+
+int
+main (int argc, char *argv[]) {
+  ProgramExitStatus exitStatus = PROG_EXIT_SUCCESS;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "asyncbench"
+    };
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!parseIntegerOption(&alarmCount, opt_alarmCount, "alarm count", 1, 10000000)) return PROG_EXIT_SYNTAX;
+  if (!parseIntegerOption(&iterationCount, opt_iterations, "iteration count", 1, 100000000)) return PROG_EXIT_SYNTAX;
+  if (!parseIntegerOption(&threadCount, opt_threads, "thread count", 1, 1000)) return PROG_EXIT_SYNTAX;
+
+  {
+    int count;
+    char **names = splitString(opt_benchmarks, ',', &count);
+
+    if (!names) return PROG_EXIT_FATAL;
+    srand(1);
+
+    for (int index=0; index<count; index+=1) {
+      const BenchmarkEntry *benchmark = getBenchmark(names[index]);
+
+      if (!benchmark) {
+        exitStatus = PROG_EXIT_SYNTAX;
+        break;
+      }
+
+      if (!benchmark->run()) {
+        exitStatus = PROG_EXIT_FATAL;
+        break;
+      }
+    }
+
+    deallocateStrings(names);
+  }
+
+  return exitStatus;
+}
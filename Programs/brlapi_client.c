@@ -377,20 +377,22 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
 
   uint32_t size;
   brlapi_packetType_t type;
-  int ret;
+  int ret = 0;
 
   struct timeval now;
   int delay = 0;
 
   do {
     if (deadline) {
+      int64_t remaining;
+
       getRealTime(&now);
-      delay = (deadline->tv_sec  - now.tv_sec ) * 1000 +
-	      (deadline->tv_usec - now.tv_usec) / 1000;
-      if (delay < 0) {
-	/* The deadline has expired, don't wait more */
-	return -4;
-      }
+      remaining = (int64_t)(deadline->tv_sec  - now.tv_sec ) * 1000000 +
+		  (deadline->tv_usec - now.tv_usec);
+
+      /* Once the deadline has expired, still check (without waiting)
+       * for data which has already arrived. */
+      delay = (remaining > 0)? (remaining + 999) / 1000: 0;
     }
 #ifdef __MINGW32__
     DWORD dw;
@@ -445,6 +447,9 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
 	/* error or end of file */
 	return -2;
       }
+    } else if (deadline && !delay) {
+      /* The deadline has expired, don't wait more */
+      return -4;
     }
   } while (ret == 0);
 
@@ -1144,8 +1149,8 @@ static int brlapi__getDriverSpecific(brlapi_handle_t *handle, const char *driver
     brlapi_errno = BRLAPI_ERROR_INVALID_PARAMETER;
     return -1;
   }
-  pthread_mutex_lock(&defaultHandle.state_mutex);
-  if ((defaultHandle.state & st)) {
+  pthread_mutex_lock(&handle->state_mutex);
+  if ((handle->state & st)) {
     brlapi_errno = BRLAPI_ERROR_ILLEGAL_INSTRUCTION;
     res = -1;
     goto out;
@@ -178,6 +178,12 @@ typedef struct {
   wchar_t *text;
   unsigned char *andAttr;
   unsigned char *orAttr;
+
+  /* text rendered with andAttr and orAttr applied (but not the cursor) */
+  unsigned char *dots;
+  unsigned int dirtyFrom, dirtyTo; /* cells which must be rendered again */
+  const TextTable *dotsTable;
+  unsigned int dotsGeneration;
 } BrailleWindow;
 
 typedef enum { TODISPLAY, EMPTY } BrlBufState;
@@ -264,6 +270,12 @@ static Connection *paramUpdateConnection;
  * 2. apiRawMutex
  * 3. acceptedKeysMutex or brailleWindowMutex
  * 4. apiDriverMutex
+ * 5. apiParamMutex
+ *
+ * apiParamMutex is only ever held with apiConnectionsMutex also held, and the
+ * readers of some parameters (see renderedCells) then take 3 and 4 anyway.
+ * That's safe since these paths are serialized by apiConnectionsMutex, and no
+ * path which holds 3 or 4 without it ever waits for apiParamMutex.
 */
 
 static Tty notty;
@@ -311,6 +323,14 @@ static BrailleDriver ApiBraille;
 static uint32_t displayDimensions[2] = { 0, 0 };
 static unsigned int displaySize = 0;
 
+/* Incremented (by the core thread) whenever the text table changes */
+static unsigned int textTableGeneration = 0;
+
+static inline unsigned int
+getTextTableGeneration (void) {
+  return __atomic_load_n(&textTableGeneration, __ATOMIC_ACQUIRE);
+}
+
 static BrailleDisplay *disp; /* Parameter to pass to braille drivers */
 
 static int coreActive; /* Whether core is active */
@@ -564,13 +584,22 @@ static int allocBrailleWindow(BrailleWindow *brailleWindow)
   if (!(brailleWindow->text = malloc(displaySize*sizeof(wchar_t)))) goto out;
   if (!(brailleWindow->andAttr = malloc(displaySize))) goto outText;
   if (!(brailleWindow->orAttr = malloc(displaySize))) goto outAnd;
+  if (!(brailleWindow->dots = malloc(displaySize))) goto outOr;
 
   wmemset(brailleWindow->text, WC_C(' '), displaySize);
   memset(brailleWindow->andAttr, 0xFF, displaySize);
   memset(brailleWindow->orAttr, 0x00, displaySize);
   brailleWindow->cursor = 0;
+
+  brailleWindow->dirtyFrom = 0;
+  brailleWindow->dirtyTo = displaySize;
+  brailleWindow->dotsTable = NULL;
+  brailleWindow->dotsGeneration = getTextTableGeneration();
   return 0;
 
+outOr:
+  free(brailleWindow->orAttr);
+
 outAnd:
   free(brailleWindow->andAttr);
 
@@ -588,6 +617,20 @@ static void freeBrailleWindow(BrailleWindow *brailleWindow)
   free(brailleWindow->text); brailleWindow->text = NULL;
   free(brailleWindow->andAttr); brailleWindow->andAttr = NULL;
   free(brailleWindow->orAttr); brailleWindow->orAttr = NULL;
+  free(brailleWindow->dots); brailleWindow->dots = NULL;
+}
+
+/* Function: invalidateBrailleWindow */
+/* Marks cells [from, to) as needing to be rendered again by getDots */
+static void invalidateBrailleWindow(BrailleWindow *brailleWindow, unsigned int from, unsigned int to)
+{
+  if (brailleWindow->dirtyFrom == brailleWindow->dirtyTo) {
+    brailleWindow->dirtyFrom = from;
+    brailleWindow->dirtyTo = to;
+  } else {
+    if (from < brailleWindow->dirtyFrom) brailleWindow->dirtyFrom = from;
+    if (to > brailleWindow->dirtyTo) brailleWindow->dirtyTo = to;
+  }
 }
 
 static unsigned char
@@ -606,15 +649,29 @@ getCursorOverlay (BrailleDisplay *brl) {
 
 /* Function: getDots */
 /* Returns the braille dots corresponding to a BrailleWindow structure */
+/* Only the cells written since the previous call are translated again */
+/* Must be called with apiDriverMutex held */
 /* No allocation of buf is performed */
-static void getDots(const BrailleWindow *brailleWindow, unsigned char *buf)
+static void getDots(BrailleWindow *brailleWindow, unsigned char *buf)
 {
-  int i;
+  unsigned int i;
   unsigned char c;
-  for (i=0; i<displaySize; i++) {
+  unsigned int generation = getTextTableGeneration();
+
+  if ((brailleWindow->dotsTable != textTable) ||
+      (brailleWindow->dotsGeneration != generation)) {
+    brailleWindow->dotsTable = textTable;
+    brailleWindow->dotsGeneration = generation;
+    invalidateBrailleWindow(brailleWindow, 0, displaySize);
+  }
+
+  for (i=brailleWindow->dirtyFrom; i<brailleWindow->dirtyTo; i++) {
     c = convertCharacterToDots(textTable, brailleWindow->text[i]);
-    buf[i] = (c & brailleWindow->andAttr[i]) | brailleWindow->orAttr[i];
+    brailleWindow->dots[i] = (c & brailleWindow->andAttr[i]) | brailleWindow->orAttr[i];
   }
+  brailleWindow->dirtyFrom = brailleWindow->dirtyTo = 0;
+
+  memcpy(buf, brailleWindow->dots, displaySize);
 
   if (brailleWindow->cursor) {
     buf[brailleWindow->cursor-1] |= cursorOverlay;
@@ -660,6 +717,7 @@ static Connection *createConnection(FileDescriptor fd, time_t currentTime)
   c->brailleWindow.text = NULL;
   c->brailleWindow.andAttr = NULL;
   c->brailleWindow.orAttr = NULL;
+  c->brailleWindow.dots = NULL;
   if (brlapi_initializePacket(&c->packet))
     goto outmalloc;
   c->subscriptions.next = &c->subscriptions;
@@ -1251,6 +1309,7 @@ static int handleWrite(Connection *c, brlapi_packetType_t type, brlapi_packet_t
 
   if (andAttr) memcpy(c->brailleWindow.andAttr+rbeg-1,andAttr,rsiz);
   if (orAttr) memcpy(c->brailleWindow.orAttr+rbeg-1,orAttr,rsiz);
+  if (text || andAttr || orAttr) invalidateBrailleWindow(&c->brailleWindow, rbeg-1, rbeg-1+rsiz);
   if (cursor >= 0) c->brailleWindow.cursor = cursor;
 
   c->brlbufstate = TODISPLAY;
@@ -1686,6 +1745,10 @@ PARAM_WRITER(cursorBlinkPercentage)
 /* BRLAPI_PARAM_RENDERED_CELLS */
 PARAM_READER(renderedCells)
 {
+  /* Called with apiConnectionsMutex and apiParamMutex held, which is out of
+   * the usual order - see the lock order comment at the top of this file.
+   */
+  lockMutex(&c->brailleWindowMutex);
   lockMutex(&apiDriverMutex);
     if (disp) {
       unsigned char buffer[displaySize];
@@ -1697,6 +1760,7 @@ PARAM_READER(renderedCells)
       *size = 0;
     }
   unlockMutex(&apiDriverMutex);
+  unlockMutex(&c->brailleWindowMutex);
 
   return NULL;
 }
@@ -2239,11 +2303,13 @@ static int handleParamValue(Connection *c, brlapi_packetType_t type, brlapi_pack
   {
     const char *error;
 
+    lockMutex(&apiConnectionsMutex);
     lockMutex(&apiParamMutex);
     paramUpdateConnection = c;
     error = writeHandler(c, param, subparam, flags, paramValue->data, size);
     paramUpdateConnection = NULL;
     unlockMutex(&apiParamMutex);
+    unlockMutex(&apiConnectionsMutex);
 
     if (error) {
       WERR(c->fd, BRLAPI_ERROR_INVALID_PARAMETER, "parameter %u write error: %s", param, error);
@@ -2314,6 +2380,8 @@ static void __handleParamUpdate(Connection *dest, brlapi_param_t param, brlapi_p
 
 static void handleParamUpdate(Connection *source, Connection *dest, brlapi_param_t param, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, const void *data, size_t size)
 {
+  /* apiConnectionsMutex must always be taken before apiParamMutex */
+  lockMutex(&apiConnectionsMutex);
   lockMutex(&apiParamMutex);
   paramUpdateConnection = source;
   if (((flags & BRLAPI_PARAMF_GLOBAL) && paramState[param].global_subscriptions)
@@ -2321,17 +2389,24 @@ static void handleParamUpdate(Connection *source, Connection *dest, brlapi_param
     __handleParamUpdate(dest, param, subparam, flags, data, size);
   paramUpdateConnection = NULL;
   unlockMutex(&apiParamMutex);
+  unlockMutex(&apiConnectionsMutex);
 }
 
 void api_updateParameter(brlapi_param_t parameter, brlapi_param_subparam_t subparam)
 {
   const ParamDispatch *pd = param_getDispatch(parameter);
 
+  /* the cached renderings of the braille windows are now stale */
+  if (parameter == BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE) {
+    __atomic_add_fetch(&textTableGeneration, 1, __ATOMIC_RELEASE);
+  }
+
   if (pd) {
     if (pd->global) {
       ParamReader *readHandler = pd->read;
 
       if (readHandler) {
+        lockMutex(&apiConnectionsMutex);
         lockMutex(&apiParamMutex);
         {
           if (paramState[parameter].global_subscriptions) {
@@ -2347,6 +2422,7 @@ void api_updateParameter(brlapi_param_t parameter, brlapi_param_subparam_t subpa
           }
         }
         unlockMutex(&apiParamMutex);
+        unlockMutex(&apiConnectionsMutex);
 
         reportParameterUpdated(parameter, subparam);
       } else {
@@ -2392,6 +2468,7 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
     WERR(c->fd, BRLAPI_ERROR_INVALID_PARAMETER, "subscribe and unsubscribe flags both set");
     return 0;
   }
+  lockMutex(&apiConnectionsMutex);
   lockMutex(&apiParamMutex);
   if (flags & BRLAPI_PARAMF_SUBSCRIBE) {
     /* subscribe to parameter updates */
@@ -2399,6 +2476,7 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
     if (param == BRLAPI_PARAM_SERVER_VERSION) {
       WERR(c->fd, BRLAPI_ERROR_INVALID_PARAMETER, "parameter %u not available for watching - it won't change", param);
       unlockMutex(&apiParamMutex);
+      unlockMutex(&apiConnectionsMutex);
       return 0;
     }
 
@@ -2408,12 +2486,12 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
       if (root) {
         WERR(c->fd, BRLAPI_ERROR_INVALID_PARAMETER, "parameter %u not available for watching - %u should be watched instead", param, root);
         unlockMutex(&apiParamMutex);
+        unlockMutex(&apiConnectionsMutex);
         return 0;
       }
     }
 
     struct Subscription *s;
-    lockMutex(&apiConnectionsMutex);
     if (flags & BRLAPI_PARAMF_GLOBAL)
       paramState[param].global_subscriptions++;
     else
@@ -2426,11 +2504,9 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
     s->prev = &c->subscriptions;
     s->next->prev = s;
     s->prev->next = s;
-    unlockMutex(&apiConnectionsMutex);
   } else if (flags & BRLAPI_PARAMF_UNSUBSCRIBE) {
     /* unsubscribe from parameter updates */
     struct Subscription *s;
-    lockMutex(&apiConnectionsMutex);
     for (s = c->subscriptions.next; s!=&c->subscriptions; s=s->next) {
       if (s->parameter == param
 	  && (s->flags & BRLAPI_PARAMF_GLOBAL) == (flags & BRLAPI_PARAMF_GLOBAL))
@@ -2450,7 +2526,6 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
       unlockMutex(&apiConnectionsMutex);
       return 0;
     }
-    unlockMutex(&apiConnectionsMutex);
   }
   if (flags & BRLAPI_PARAMF_GET) { /* Ack by sending parameter value */
     brlapi_packet_t response;
@@ -2473,6 +2548,7 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
     writeAck(c->fd);
   }
   unlockMutex(&apiParamMutex);
+  unlockMutex(&apiConnectionsMutex);
   return 0;
 }
 
@@ -3527,6 +3603,7 @@ THREAD_FUNCTION(runServer) {
     pthread_mutexattr_t attributes;
     pthread_mutexattr_init(&attributes);
     pthread_mutex_init(&apiSocketsMutex, &attributes);
+    setAddressName(&apiSocketsMutex, "apiSocketsMutex");
     serverSocketsPending = serverSocketCount;
   }
 
@@ -4436,10 +4513,19 @@ int api_startServer(BrailleDisplay *brl, char **parameters)
   pthread_mutexattr_settype(&mattr, PTHREAD_MUTEX_RECURSIVE);
 
   pthread_mutex_init(&apiConnectionsMutex,&mattr);
+  setAddressName(&apiConnectionsMutex, "apiConnectionsMutex");
+
   pthread_mutex_init(&apiDriverMutex,&mattr);
+  setAddressName(&apiDriverMutex, "apiDriverMutex");
+
   pthread_mutex_init(&apiRawMutex,&mattr);
+  setAddressName(&apiRawMutex, "apiRawMutex");
+
   pthread_mutex_init(&apiSuspendMutex,&mattr);
+  setAddressName(&apiSuspendMutex, "apiSuspendMutex");
+
   pthread_mutex_init(&apiParamMutex,&mattr);
+  setAddressName(&apiParamMutex, "apiParamMutex");
 
   pthread_attr_init(&attr);
   pthread_attr_setstacksize(&attr,stackSize);
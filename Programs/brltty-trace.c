@@ -0,0 +1,272 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "trace.h"
+#include "timing.h"
+
+static int opt_relativeTimes;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .letter = 'r',
+    .word = "relative",
+    .setting.flag = &opt_relativeTimes,
+    .description = "Show times relative to the first record."
+  },
+END_OPTION_TABLE
+
+typedef struct {
+  const char *name;
+  TraceFormat format;
+  const char *template;
+} TraceEventEntry;
+
+static const TraceEventEntry traceEventTable[] = {
+#define TRACE_EVENT_ENTRY(identifier, name, format, template) {name, format, template},
+  TRACE_EVENTS
+#undef TRACE_EVENT_ENTRY
+};
+
+#define THREAD_NAME_SIZE (sizeof(((TraceRecord *)NULL)->arguments) + 1)
+typedef char ThreadName[THREAD_NAME_SIZE];
+
+static ThreadName *threadNames = NULL;
+static unsigned int threadNameCount = 0;
+
+static const char *
+getThreadName (unsigned int thread) {
+  if (thread < threadNameCount) {
+    const char *name = threadNames[thread];
+    if (*name) return name;
+  }
+
+  return "?";
+}
+
+static int
+recordThreadName (const TraceRecord *record) {
+  unsigned int thread = record->thread;
+
+  if (thread >= threadNameCount) {
+    unsigned int count = thread + 1;
+    ThreadName *names = realloc(threadNames, ARRAY_SIZE(names, count));
+
+    if (!names) {
+      logMallocError();
+      return 0;
+    }
+
+    memset(&names[threadNameCount], 0, ARRAY_SIZE(names, (count - threadNameCount)));
+    threadNames = names;
+    threadNameCount = count;
+  }
+
+  memcpy(threadNames[thread], record->arguments, sizeof(record->arguments));
+  threadNames[thread][sizeof(record->arguments)] = 0;
+  return 1;
+}
+
+static void
+printTime (uint64_t time, const TraceFileHeader *header, uint64_t firstTime) {
+  if (opt_relativeTimes) {
+    uint64_t elapsed = time - firstTime;
+
+    printf("%llu.%06llu",
+           (unsigned long long int)(elapsed / NSECS_PER_SEC),
+           (unsigned long long int)((elapsed % NSECS_PER_SEC) / NSECS_PER_USEC));
+  } else {
+    int64_t real = (int64_t)time + header->realTimeOffset;
+    time_t seconds = real / NSECS_PER_SEC;
+    char buffer[0X20];
+
+    strftime(buffer, sizeof(buffer), "%Y-%m-%d@%H:%M:%S", localtime(&seconds));
+    printf("%s.%06u", buffer, (unsigned int)((real % NSECS_PER_SEC) / NSECS_PER_USEC));
+  }
+}
+
+static void
+printRecord (const TraceRecord *record, const TraceFileHeader *header, uint64_t firstTime) {
+  const uint32_t *arguments = record->arguments;
+
+  printTime(record->time, header, firstTime);
+  printf(" [%s] ", getThreadName(record->thread));
+
+  if (record->event >= ARRAY_COUNT(traceEventTable)) {
+    printf("event %u: %u %u %u %u %u\n", record->event,
+           arguments[0], arguments[1], arguments[2], arguments[3], arguments[4]);
+    return;
+  }
+
+  {
+    const TraceEventEntry *event = &traceEventTable[record->event];
+    printf("%s", event->name);
+
+    switch (event->format) {
+      case TRACE_FMT_NUMBERS:
+        if (*event->template) {
+          printf(": ");
+          printf(event->template,
+                 arguments[0], arguments[1], arguments[2], arguments[3], arguments[4]);
+        }
+        break;
+
+      case TRACE_FMT_BYTES: {
+        const unsigned char *byte = (const unsigned char *)&arguments[1];
+        size_t count = MIN(arguments[0], (sizeof(record->arguments) - sizeof(arguments[0])));
+
+        printf(": %u:", arguments[0]);
+        while (count--) printf(" %02X", *byte++);
+        if (arguments[0] > (sizeof(record->arguments) - sizeof(arguments[0]))) printf(" ...");
+        break;
+      }
+
+      case TRACE_FMT_TEXT:
+        printf(": %.*s", (int)sizeof(record->arguments), (const char *)arguments);
+        break;
+    }
+
+    printf("\n");
+  }
+}
+
+static int
+compareRecords (const void *element1, const void *element2) {
+  const TraceRecord *const *pointer1 = element1;
+  const TraceRecord *const *pointer2 = element2;
+  const TraceRecord *record1 = *pointer1;
+  const TraceRecord *record2 = *pointer2;
+
+  if (record1->time < record2->time) return -1;
+  if (record1->time > record2->time) return 1;
+
+  /* The records themselves aren't moved, so their addresses preserve the
+   * file order (which is per-thread order) of simultaneous records.
+   */
+  if (record1 < record2) return -1;
+  if (record1 > record2) return 1;
+  return 0;
+}
+
+static ProgramExitStatus
+decodeTrace (const char *path) {
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+  FILE *file;
+
+  if ((file = fopen(path, "rb"))) {
+    TraceFileHeader header;
+
+    if ((fread(&header, sizeof(header), 1, file) != 1) ||
+        (memcmp(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic)) != 0)) {
+      logMessage(LOG_ERR, "not a trace file: %s", path);
+      exitStatus = PROG_EXIT_SEMANTIC;
+    } else if ((header.version != TRACE_FILE_VERSION) || (header.recordSize != sizeof(TraceRecord))) {
+      logMessage(LOG_ERR, "unsupported trace file: %s: version %u", path, header.version);
+      exitStatus = PROG_EXIT_SEMANTIC;
+    } else {
+      TraceRecord *records = NULL;
+      const TraceRecord **order = NULL;
+      size_t count = 0;
+      size_t size = 0;
+
+      while (1) {
+        if (count == size) {
+          size_t newSize = size? size<<1: 0X1000;
+          TraceRecord *newRecords = realloc(records, ARRAY_SIZE(newRecords, newSize));
+
+          if (!newRecords) {
+            logMallocError();
+            goto done;
+          }
+
+          records = newRecords;
+          size = newSize;
+        }
+
+        {
+          size_t read = fread(&records[count], sizeof(*records), (size - count), file);
+
+          count += read;
+          if (count < size) break;
+        }
+      }
+
+      if (ferror(file)) {
+        logMessage(LOG_ERR, "trace file read error: %s: %s", path, strerror(errno));
+      } else if (count && !(order = malloc(ARRAY_SIZE(order, count)))) {
+        logMallocError();
+      } else {
+        uint64_t firstTime;
+
+        for (size_t index=0; index<count; index+=1) order[index] = &records[index];
+        qsort(order, count, sizeof(*order), compareRecords);
+        firstTime = count? order[0]->time: 0;
+
+        for (size_t index=0; index<count; index+=1) {
+          const TraceRecord *record = order[index];
+
+          if (record->event == TRACE_EVT_THREAD_NAME) {
+            if (!recordThreadName(record)) goto done;
+          } else {
+            printRecord(record, &header, firstTime);
+          }
+        }
+
+        exitStatus = PROG_EXIT_SUCCESS;
+      }
+
+    done:
+      if (order) free(order);
+      if (records) free(records);
+    }
+
+    fclose(file);
+  } else {
+    logMessage(LOG_ERR, "trace file open error: %s: %s", path, strerror(errno));
+  }
+
+  return exitStatus;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "brltty-trace",
+      .argumentsSummary = "file"
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (argc != 1) {
+    logMessage(LOG_ERR, "%s", (argc? "too many parameters": "missing trace file"));
+    return PROG_EXIT_SYNTAX;
+  }
+
+  return decodeTrace(argv[0]);
+}
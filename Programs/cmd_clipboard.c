@@ -30,6 +30,8 @@
 #include "clipboard.h"
 #include "brl_cmds.h"
 #include "scr.h"
+#include "scr_search.h"
+#include "prefs.h"
 #include "routing.h"
 #include "file.h"
 #include "datafile.h"
@@ -404,28 +406,6 @@ cpbRestore (ClipboardCommandData *ccd) {
   return ok;
 }
 
-static int
-findCharacters (const wchar_t **address, size_t *length, const wchar_t *characters, size_t count) {
-  const wchar_t *ptr = *address;
-  size_t len = *length;
-
-  while (count <= len) {
-    const wchar_t *next = wmemchr(ptr, *characters, len);
-    if (!next) break;
-
-    len -= next - ptr;
-    if (wmemcmp((ptr = next), characters, count) == 0) {
-      *address = ptr;
-      *length = len;
-      return 1;
-    }
-
-    ++ptr, --len;
-  }
-
-  return 0;
-}
-
 static int
 handleClipboardCommands (int command, void *data) {
   ClipboardCommandData *ccd = data;
@@ -460,58 +440,33 @@ handleClipboardCommands (int command, void *data) {
     doSearch:
       lockMainClipboard();
         if ((cpbBuffer = getClipboardContent(ccd->clipboard, &cpbLength))) {
-          int found = 0;
-          size_t count = cpbLength;
-
-          if (count <= scr.cols) {
-            int line = ses->winy;
-            wchar_t buffer[scr.cols];
-            wchar_t characters[count];
-
-            {
-              unsigned int i;
-              for (i=0; i<count; i+=1) characters[i] = towlower(cpbBuffer[i]);
-            }
+          ScreenSearch *search = NULL;
 
-            while ((line >= 0) && (line <= (int)(scr.rows - brl.textRows))) {
-              const wchar_t *address = buffer;
-              size_t length = scr.cols;
-              readScreenText(0, line, length, 1, buffer);
-
-              {
-                for (size_t i=0; i<length; i+=1) buffer[i] = towlower(buffer[i]);
-              }
-
-              if (line == ses->winy) {
-                if (increment < 0) {
-                  int end = ses->winx + count - 1;
-                  if (end < length) length = end;
-                } else {
-                  int start = ses->winx + textCount;
-                  if (start > length) start = length;
-                  address += start;
-                  length -= start;
-                }
-              }
+          if (prefs.regularExpressionSearch || (cpbLength <= scr.cols)) {
+            search = newScreenSearch(
+              cpbBuffer, cpbLength,
+              !prefs.caseSensitiveSearch, prefs.regularExpressionSearch
+            );
+          }
 
-              if (findCharacters(&address, &length, characters, count)) {
-                if (increment < 0) {
-                  while (findCharacters(&address, &length, characters, count)) {
-                    ++address, --length;
-                  }
-                }
+          if (search) {
+            int rows = scr.rows - brl.textRows + 1;
+            int row = ses->winy;
+            int column = ses->winx;
 
-                ses->winy = line;
-                ses->winx = (address - buffer) / textCount * textCount;
-                found = 1;
-                break;
-              }
+            if (increment > 0) column += textCount;
 
-              line += increment;
+            if (findScreenSearchMatch(search, scr.cols, rows, &column, &row, (increment < 0))) {
+              ses->winy = row;
+              ses->winx = column / textCount * textCount;
+            } else {
+              alert(ALERT_BOUNCE);
             }
-          }
 
-          if (!found) alert(ALERT_BOUNCE);
+            destroyScreenSearch(search);
+          } else {
+            alert(ALERT_BOUNCE);
+          }
         } else {
           alert(ALERT_COMMAND_REJECTED);
         }
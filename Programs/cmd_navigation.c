@@ -19,6 +19,7 @@
 #include "prologue.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #include "log.h"
 #include "alert.h"
@@ -30,9 +31,11 @@
 #include "brl_cmds.h"
 #include "parse.h"
 #include "rgx.h"
+#include "utf8.h"
 #include "prefs.h"
 #include "routing.h"
 #include "scr.h"
+#include "scr_index.h"
 #include "core.h"
 
 static int
@@ -56,6 +59,12 @@ canMoveDown (void) {
   return (ses->winy + brl.textRows) < scr.rows;
 }
 
+static int
+isCursorInRange (int from, int width) {
+  return showScreenCursor() && (scr.posy == ses->winy) &&
+         (scr.posx >= from) && (scr.posx < (from + width));
+}
+
 static int
 toDifferentLine (
   IsSameCharacter isSameCharacter,
@@ -63,25 +72,45 @@ toDifferentLine (
   int amount, int from, int width
 ) {
   if (canMoveWindow()) {
-    ScreenCharacter characters1[width];
     unsigned int skipped = 0;
 
     if ((isSameCharacter == isSameText) && ses->displayMode) isSameCharacter = isSameAttributes;
-    readScreen(from, ses->winy, width, 1, characters1);
 
-    do {
-      ScreenCharacter characters2[width];
-      readScreen(from, ses->winy+=amount, width, 1, characters2);
+    if ((from == 0) && (width == scr.cols)) {
+      /* whole rows are compared by their hashes */
+      int compareText = isSameCharacter != isSameAttributes;
+      int compareAttributes = isSameCharacter != isSameText;
+      ScreenRowSummary summary1 = *getScreenRowSummary(ses->winy);
 
-      if (!isSameRow(characters1, characters2, width, isSameCharacter) ||
-          (showScreenCursor() && (scr.posy == ses->winy) &&
-           (scr.posx >= from) && (scr.posx < (from + width)))) {
-        return 1;
-      }
+      do {
+        const ScreenRowSummary *summary2 = getScreenRowSummary(ses->winy+=amount);
+
+        if ((compareText && (summary2->textHash != summary1.textHash)) ||
+            (compareAttributes && (summary2->attributesHash != summary1.attributesHash)) ||
+            isCursorInRange(from, width)) {
+          return 1;
+        }
+
+        /* lines are identical */
+        alertLineSkipped(&skipped);
+      } while (canMoveWindow());
+    } else {
+      ScreenCharacter characters1[width];
+      readScreen(from, ses->winy, width, 1, characters1);
+
+      do {
+        ScreenCharacter characters2[width];
+        readScreen(from, ses->winy+=amount, width, 1, characters2);
+
+        if (!isSameRow(characters1, characters2, width, isSameCharacter) ||
+            isCursorInRange(from, width)) {
+          return 1;
+        }
 
-      /* lines are identical */
-      alertLineSkipped(&skipped);
-    } while (canMoveWindow());
+        /* lines are identical */
+        alertLineSkipped(&skipped);
+      } while (canMoveWindow());
+    }
   }
 
   alert(ALERT_BOUNCE);
@@ -166,29 +195,161 @@ findRow (int column, int increment, RowTester test, void *data) {
 
 static int
 testIndent (int column, int row, void *data UNUSED) {
-  int count = column+1;
-  ScreenCharacter characters[count];
-  readScreenRow(row, count, characters);
-
-  while (column >= 0) {
-    wchar_t text = characters[column].text;
-    if (text != WC_C(' ')) return 1;
-    column -= 1;
-  }
-
-  return 0;
+  return !isBlankScreenRange(getScreenRowSummary(row), 0, column);
 }
 
+/* The prompt patterns are also merged into a single alternation so that a
+ * row only needs to be matched once. If the merged expression can't be
+ * used (e.g. a pattern has a numbered back reference, which merging would
+ * renumber), each pattern is matched on its own. Results are remembered by
+ * row content so that rows which haven't changed aren't matched again.
+ */
+
+#define PROMPT_CACHE_SIZE 0X100
+
+typedef struct {
+  uint64_t hash;
+  unsigned char isValid;
+  unsigned char isPrompt;
+} PromptCacheEntry;
+
 static RGX_Object *promptPatterns = NULL;
+static RGX_Object *promptAlternation = NULL;
+static wchar_t *promptAlternationText = NULL;
+static size_t promptAlternationLength = 0;
+static unsigned char promptAlternationChanged = 0;
+static unsigned char promptAlternationUsable = 1;
+static PromptCacheEntry promptCache[PROMPT_CACHE_SIZE];
+
+static void
+clearPromptCache (void) {
+  memset(promptCache, 0, sizeof(promptCache));
+}
+
+static void
+destroyPromptAlternation (void) {
+  if (promptAlternation) {
+    rgxDestroyObject(promptAlternation);
+    promptAlternation = NULL;
+  }
+}
 
 static void
 exitPromptPatterns (void *data) {
+  destroyPromptAlternation();
+
+  if (promptAlternationText) {
+    free(promptAlternationText);
+    promptAlternationText = NULL;
+  }
+
+  promptAlternationLength = 0;
+
   if (promptPatterns) {
     rgxDestroyObject(promptPatterns);
     promptPatterns = NULL;
   }
 }
 
+static int
+canMergePromptPattern (const wchar_t *characters, size_t length) {
+  for (size_t index=1; index<length; index+=1) {
+    wchar_t previous = characters[index-1];
+    wchar_t character = characters[index];
+
+    if (previous == WC_C('\\')) {
+      if (iswdigit(character)) return 0;
+      if (character == WC_C('g')) return 0;
+      if (character == WC_C('k')) return 0;
+      index += 1;
+    } else if ((previous == WC_C('(')) && (character == WC_C('?'))) {
+      if (index+1 < length) {
+        wchar_t next = characters[index+1];
+
+        if (iswdigit(next)) return 0;
+        if (wcschr(WS_C("R+-&P"), next)) return 0;
+      }
+    }
+  }
+
+  return 1;
+}
+
+static void
+appendPromptAlternation (const char *string) {
+  if (!promptAlternationUsable) return;
+
+  size_t size = strlen(string) + 1;
+  wchar_t characters[size];
+  size_t count;
+
+  {
+    const char *from = string;
+    wchar_t *to = characters;
+
+    convertUtf8ToWchars(&from, &to, size);
+    count = to - characters;
+  }
+
+  if (!canMergePromptPattern(characters, count)) {
+    promptAlternationUsable = 0;
+    return;
+  }
+
+  {
+    static const wchar_t prefix[] = WS_C("|(?:");
+    const size_t prefixLength = ARRAY_COUNT(prefix) - 1;
+
+    const wchar_t *from = prefix;
+    size_t fromLength = prefixLength;
+
+    if (!promptAlternationLength) from += 1, fromLength -= 1;
+
+    size_t newLength = promptAlternationLength + fromLength + count + 1;
+    wchar_t *newText = realloc(promptAlternationText, ARRAY_SIZE(newText, newLength));
+
+    if (!newText) {
+      logMallocError();
+      promptAlternationUsable = 0;
+      return;
+    }
+
+    wchar_t *to = &newText[promptAlternationLength];
+    wmemcpy(to, from, fromLength);
+    to += fromLength;
+    wmemcpy(to, characters, count);
+    to += count;
+    *to++ = WC_C(')');
+
+    promptAlternationText = newText;
+    promptAlternationLength = newLength;
+    promptAlternationChanged = 1;
+  }
+}
+
+static void
+preparePromptAlternation (void) {
+  promptAlternationChanged = 0;
+  destroyPromptAlternation();
+
+  if (promptAlternationUsable) {
+    if ((promptAlternation = rgxNewObject(NULL))) {
+      rgxCompileOption(promptAlternation, RGX_OPTION_SET, RGX_COMPILE_ANCHOR_START);
+
+      if (rgxAddPatternCharacters(promptAlternation,
+                                  promptAlternationText, promptAlternationLength,
+                                  NULL, NULL)) {
+        return;
+      }
+
+      destroyPromptAlternation();
+    }
+
+    promptAlternationUsable = 0;
+    logMessage(LOG_WARNING, "prompt patterns not merged");
+  }
+}
+
 int
 addPromptPattern (const char *string) {
   if (!promptPatterns) {
@@ -202,6 +363,8 @@ addPromptPattern (const char *string) {
   );
 
   if (!matcher) return 0;
+  appendPromptAlternation(string);
+  clearPromptCache();
   return 1;
 }
 
@@ -219,6 +382,10 @@ testPromptOriginal (int column, int row, void *data) {
 
 static int
 testPromptPatterns (int column, int row, void *data) {
+  uint64_t hash = getScreenRowSummary(row)->textHash;
+  PromptCacheEntry *entry = &promptCache[hash % PROMPT_CACHE_SIZE];
+  if (entry->isValid && (entry->hash == hash)) return entry->isPrompt;
+
   int length = scr.cols;
   wchar_t text[length];
 
@@ -233,7 +400,13 @@ testPromptPatterns (int column, int row, void *data) {
     while (from < end) *to++ = from++->text;
   }
 
-  return !!rgxMatchTextCharacters(promptPatterns, text, length, NULL, NULL);
+  if (promptAlternationChanged) preparePromptAlternation();
+  RGX_Object *patterns = promptAlternation? promptAlternation: promptPatterns;
+
+  entry->hash = hash;
+  entry->isPrompt = !!rgxMatchTextCharacters(patterns, text, length, NULL, NULL);
+  entry->isValid = 1;
+  return entry->isPrompt;
 }
 
 static void
@@ -263,12 +436,17 @@ toPreviousNonblankWindow (void) {
 
     charCount = getWindowLength();
     charCount = MIN(charCount, scr.cols-ses->winx);
-    readScreen(ses->winx, ses->winy, charCount, 1, characters);
 
-    for (charIndex=charCount-1; charIndex>=0; charIndex-=1) {
-      wchar_t text = characters[charIndex].text;
+    if (isBlankScreenRange(getScreenRowSummary(ses->winy), ses->winx, ses->winx+charCount-1)) {
+      charIndex = -1;
+    } else {
+      readScreen(ses->winx, ses->winy, charCount, 1, characters);
 
-      if (text != WC_C(' ')) break;
+      for (charIndex=charCount-1; charIndex>=0; charIndex-=1) {
+        wchar_t text = characters[charIndex].text;
+
+        if (text != WC_C(' ')) break;
+      }
     }
 
     if (showScreenCursor() &&
@@ -309,12 +487,17 @@ toNextNonblankWindow (void) {
 
     charCount = getWindowLength();
     charCount = MIN(charCount, scr.cols-ses->winx);
-    readScreen(ses->winx, ses->winy, charCount, 1, characters);
 
-    for (charIndex=0; charIndex<charCount; charIndex+=1) {
-      wchar_t text = characters[charIndex].text;
+    if (isBlankScreenRange(getScreenRowSummary(ses->winy), ses->winx, ses->winx+charCount-1)) {
+      charIndex = charCount;
+    } else {
+      readScreen(ses->winx, ses->winy, charCount, 1, characters);
 
-      if (text != WC_C(' ')) break;
+      for (charIndex=0; charIndex<charCount; charIndex+=1) {
+        wchar_t text = characters[charIndex].text;
+
+        if (text != WC_C(' ')) break;
+      }
     }
 
     if (showScreenCursor() &&
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include "log.h"
+#include "trace.h"
 #include "cmd_queue.h"
 #include "cmd_enqueue.h"
 #include "cmd_utils.h"
@@ -149,6 +150,8 @@ handleCommand (int command) {
   const CommandEnvironment *env = commandEnvironmentStack;
   const CommandHandlerLevel *chl = env->handlerStack;
 
+  TRACE_EVENT(COMMAND, command);
+
   while (chl) {
     if (chl->handleCommand(command, chl->handlerData)) return 1;
     chl = chl->previousLevel;
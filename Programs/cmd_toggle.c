@@ -266,6 +266,31 @@ handleToggleCommands (int command, void *data) {
       break;
     }
 
+    case BRL_CMD_FREEZE_PREV:
+    case BRL_CMD_FREEZE_NEXT: {
+      int offset = ((command & BRL_MSK_CMD) == BRL_CMD_FREEZE_PREV)? -1: 1;
+
+      if (!prefs.screenHistory) {
+        alert(ALERT_COMMAND_REJECTED);
+        break;
+      }
+
+      if (isMainScreen()) {
+        if ((offset > 0) || !activateSpecialScreen(SCR_FROZEN)) {
+          alert(ALERT_COMMAND_REJECTED);
+          break;
+        }
+
+        alert(ALERT_SCREEN_FROZEN);
+      } else if (!isSpecialScreen(SCR_FROZEN)) {
+        alert(ALERT_COMMAND_REJECTED);
+        break;
+      }
+
+      if (!selectFrozenScreenImage(offset)) alert(ALERT_COMMAND_REJECTED);
+      break;
+    }
+
     default:
       return 0;
   }
@@ -29,6 +29,7 @@
 #include "parameters.h"
 #include "embed.h"
 #include "log.h"
+#include "trace.h"
 #include "report.h"
 #include "strfmt.h"
 #include "pgmprivs.h"
@@ -178,6 +179,7 @@ static int opt_noDaemon;
 static int opt_standardError;
 static char *opt_logLevel;
 static char *opt_logFile;
+static char *opt_traceFile;
 static int opt_bootParameters = 1;
 static int opt_environmentVariables;
 static char *opt_messageHoldTimeout;
@@ -659,6 +661,14 @@ BEGIN_OPTION_TABLE(programOptions)
     .description = strtext("Path to log file.")
   },
 
+  { .letter = 'j',
+    .word = "trace-file",
+    .flags = OPT_Hidden | OPT_Config | OPT_Environ,
+    .argument = strtext("file"),
+    .setting.string = &opt_traceFile,
+    .description = strtext("Path to binary trace file (decode it with brltty-trace).")
+  },
+
   { .letter = 'v',
     .word = "verify",
     .setting.flag = &opt_verify,
@@ -727,6 +737,7 @@ changeLogLevel (const char *operand) {
     deallocateStrings(strings);
   }
 
+  updateLockProfiling();
   return ok;
 }
 
@@ -742,6 +753,11 @@ exitLog (void *data) {
   closeLogFile();
 }
 
+static void
+exitTrace (void *data) {
+  stopTrace();
+}
+
 static void
 setLogLevels (void) {
   systemLogLevel = LOG_NOTICE;
@@ -820,6 +836,10 @@ brlttyPrepare (int argc, char *argv[]) {
     openSystemLog();
   }
 
+  if (*opt_traceFile) {
+    if (startTrace(opt_traceFile)) onProgramExit("trace", exitTrace, NULL);
+  }
+
   logProgramBanner();
   logProperty(opt_logLevel, "logLevel", gettext("Log Level"));
 
@@ -2597,6 +2617,8 @@ background (void) {
     logSystemError("setsid");
     exit(PROG_EXIT_FATAL);
   }
+
+  resumeLogWriter();
 }
 #endif /* background() */
 
@@ -57,6 +57,8 @@
 #include "async_event.h"
 #include "async_signal.h"
 #include "async_task.h"
+#include "async_profile.h"
+#include "lock_profile.h"
 
 #include "brl_cmds.h"
 #include "timing.h"
@@ -1526,6 +1528,42 @@ ASYNC_SIGNAL_HANDLER(handleChildDeath) {
 #endif /* SIGCHLD */
 #endif /* ASYNC_CAN_HANDLE_SIGNALS */
 
+#ifdef ASYNC_CAN_MONITOR_SIGNALS
+#ifdef SIGUSR1
+static ASYNC_SIGNAL_CALLBACK(handleProfileReportRequest) {
+  asyncLogCallbackProfile(20);
+  logLockProfile(20);
+  return 1;
+}
+#endif /* SIGUSR1 */
+#endif /* ASYNC_CAN_MONITOR_SIGNALS */
+
+static AsyncHandle lockProfileAlarm = NULL;
+static unsigned char lockProfilingEnabled = 0;
+
+ASYNC_ALARM_CALLBACK(handleLockProfileAlarm) {
+  if (isLockProfilingEnabled()) logLockProfile(20);
+}
+
+void
+updateLockProfiling (void) {
+  unsigned char enabled = isLockProfilingEnabled();
+
+  if (enabled != lockProfilingEnabled) {
+    if ((lockProfilingEnabled = enabled)) {
+      /* releases weren't seen while it was off */
+      resetLockHoldState();
+
+      if (asyncNewRelativeAlarm(&lockProfileAlarm, LOCK_PROFILE_REPORT_INTERVAL, handleLockProfileAlarm, NULL)) {
+        asyncResetAlarmInterval(lockProfileAlarm, LOCK_PROFILE_REPORT_INTERVAL);
+      }
+    } else if (lockProfileAlarm) {
+      asyncCancelRequest(lockProfileAlarm);
+      lockProfileAlarm = NULL;
+    }
+  }
+}
+
 ProgramExitStatus
 brlttyConstruct (int argc, char *argv[]) {
   {
@@ -1567,12 +1605,23 @@ brlttyConstruct (int argc, char *argv[]) {
 #endif /* SIGCHLD */
 #endif /* ASYNC_CAN_HANDLE_SIGNALS */
 
+#ifdef ASYNC_CAN_MONITOR_SIGNALS
+#ifdef SIGUSR1
+  /* SIGUSR1 logs the callback run time and lock contention profiles. */
+  asyncMonitorSignal(NULL, SIGUSR1, handleProfileReportRequest, NULL);
+#endif /* SIGUSR1 */
+#endif /* ASYNC_CAN_MONITOR_SIGNALS */
+
   interruptEnabledCount = 0;
   interruptEvent = NULL;
   interruptPending = 0;
 
   delayedCursorTrackingAlarm = NULL;
 
+  asyncBeginCallbackProfile();
+  beginLockProfile();
+  updateLockProfiling();
+
   startCoreTasks();
   beginCommandQueue();
   beginUpdates();
@@ -1596,6 +1645,13 @@ brlttyConstruct (int argc, char *argv[]) {
 
 int
 brlttyDestruct (void) {
+  if (lockProfileAlarm) {
+    asyncCancelRequest(lockProfileAlarm);
+    lockProfileAlarm = NULL;
+  }
+
+  lockProfilingEnabled = 0;
+
   suspendUpdates();
   stopCoreTasks();
   endProgram();
@@ -153,6 +153,7 @@ extern KeyTable *keyboardTable;
 
 extern ProgramExitStatus brlttyPrepare (int argc, char *argv[]);
 extern ProgramExitStatus brlttyStart (void);
+extern void updateLockProfiling (void);
 
 extern void setPreferences (const PreferenceSettings *newPreferences);
 extern int loadPreferences (void);
@@ -76,6 +76,9 @@ extern "C" {
 #define DEFAULT_SCROLL_AWARE_CURSOR_NAVIGATION 0
 #define DEFAULT_CURSOR_TRACKING_DELAY ctd250ms
 #define DEFAULT_TRACK_SCREEN_SCROLL 0		/* 1 for on, 0 for off */
+#define DEFAULT_CASE_SENSITIVE_SEARCH 0		/* 1 for on, 0 for off */
+#define DEFAULT_REGULAR_EXPRESSION_SEARCH 0		/* 1 for on, 0 for off */
+#define DEFAULT_SCREEN_HISTORY 0		/* 1 for on, 0 for off */
 #define DEFAULT_TRACK_SCREEN_POINTER 0		/* 1 for on, 0 for off */
 #define DEFAULT_HIGHLIGHT_BRAILLE_WINDOW_LOCATION 0		/* 1 for on, 0 for off */
 #define DEFAULT_START_SELECTION_WITH_ROUTING_KEY 0		/* 1 for on, 0 for off */
@@ -19,6 +19,7 @@
 #include "prologue.h"
 
 #include "log.h"
+#include "trace.h"
 #include "driver.h"
 
 void
@@ -28,11 +29,13 @@ unsupportedDeviceIdentifier (const char *identifier) {
 
 void
 logOutputPacket (const void *packet, size_t size) {
+  TRACE_BYTES(OUTPUT_PACKET, packet, size);
   logBytes(LOG_CATEGORY(OUTPUT_PACKETS), "sent", packet, size);
 }
 
 void
 logInputPacket (const void *packet, size_t size) {
+  TRACE_BYTES(INPUT_PACKET, packet, size);
   logBytes(LOG_CATEGORY(INPUT_PACKETS), NULL, packet, size);
 }
 
@@ -22,6 +22,7 @@
 #include <errno.h>
 
 #include "log.h"
+#include "trace.h"
 #include "async_wait.h"
 #include "async_alarm.h"
 #include "io_generic.h"
@@ -339,6 +340,7 @@ gioReadData (GioEndpoint *endpoint, void *buffer, size_t size, int wait) {
                                 (wait? endpoint->options.inputTimeout: 0), 0);
 
         if (result > 0) {
+          TRACE_BYTES(GENERIC_INPUT, &endpoint->input.buffer[endpoint->input.to], result);
           logBytes(LOG_CATEGORY(GENERIC_INPUT), NULL, &endpoint->input.buffer[endpoint->input.to], result);
           endpoint->input.to += result;
           wait = 1;
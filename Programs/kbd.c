@@ -21,6 +21,7 @@
 #include <string.h>
 
 #include "log.h"
+#include "trace.h"
 #include "parse.h"
 #include "bitmask.h"
 #include "kbd.h"
@@ -115,6 +116,8 @@ checkKeyboardProperties (const KeyboardProperties *actual, const KeyboardPropert
 
 static void
 logKeyEvent (const char *action, int code, int press) {
+  TRACE_EVENT(KEYBOARD_KEY, code, press);
+
   logMessage(LOG_CATEGORY(KEYBOARD_KEYS),
              "%s %d: %s",
              (press? "press": "release"), code, action);
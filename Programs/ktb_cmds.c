@@ -28,6 +28,8 @@ static const CommandListEntry commandList_modes[] = {
   { .code = BRL_CMD_INFO },
   { .code = BRL_CMD_DISPMD },
   { .code = BRL_CMD_FREEZE },
+  { .code = BRL_CMD_FREEZE_PREV },
+  { .code = BRL_CMD_FREEZE_NEXT },
   { .code = BRL_CMD_BLK(DESCCHAR) },
   { .code = BRL_CMD_TIME },
   { .code = BRL_CMD_INDICATORS },
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include "log.h"
+#include "trace.h"
 #include "strfmt.h"
 #include "alert.h"
 #include "prefs.h"
@@ -623,6 +624,7 @@ processKeyEvent (
   }
 
   logKeyEvent(table, (press? "press": "release"), context, &keyValue, command);
+  TRACE_EVENT(BRAILLE_KEY, keyGroup, keyNumber, press, context, state);
   return state;
 }
 
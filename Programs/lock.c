@@ -22,6 +22,7 @@
 #include <errno.h>
 
 #include "lock.h"
+#include "lock_profile.h"
 #include "log.h"
 #include "get_thread.h"
  
@@ -31,6 +32,7 @@
 
 struct LockDescriptorStruct {
   pthread_rwlock_t lock;
+  const char *name;
 };
 
 static int
@@ -51,8 +53,8 @@ destructLockDescriptor (LockDescriptor *lock) {
   pthread_rwlock_destroy(&lock->lock);
 }
 
-int
-obtainLock (LockDescriptor *lock, LockOptions options) {
+static int
+acquireLock (LockDescriptor *lock, LockOptions options) {
   if (options & LOCK_Exclusive) {
     if (options & LOCK_NoWait) return !pthread_rwlock_trywrlock(&lock->lock);
     pthread_rwlock_wrlock(&lock->lock);
@@ -64,8 +66,8 @@ obtainLock (LockDescriptor *lock, LockOptions options) {
   return 1;
 }
 
-void
-releaseLock (LockDescriptor *lock) {
+static void
+relinquishLock (LockDescriptor *lock) {
   pthread_rwlock_unlock(&lock->lock);
 }
 
@@ -78,6 +80,7 @@ struct LockDescriptorStruct {
   pthread_cond_t write;
   int count;
   unsigned int writers;
+  const char *name;
 };
 
 static int
@@ -114,8 +117,8 @@ destructLockDescriptor (LockDescriptor *lock) {
   pthread_cond_destroy(&lock->write);
 }
 
-int
-obtainLock (LockDescriptor *lock, LockOptions options) {
+static int
+acquireLock (LockDescriptor *lock, LockOptions options) {
   int locked = 0;
 
   pthread_mutex_lock(&lock->mutex);
@@ -144,8 +147,8 @@ done:
   return locked;
 }
 
-void
-releaseLock (LockDescriptor *lock) {
+static void
+relinquishLock (LockDescriptor *lock) {
   pthread_mutex_lock(&lock->mutex);
 
   if (lock->count < 0) {
@@ -167,6 +170,34 @@ done:
 #endif /* lock paradigm */
 
 #ifdef CAN_LOCK
+int
+obtainLock (LockDescriptor *lock, LockOptions options) {
+  if (isLockProfilingEnabled()) {
+    TimeValue waitStart;
+    int contended = 0;
+
+    if (!acquireLock(lock, (options | LOCK_NoWait))) {
+      if (options & LOCK_NoWait) return 0;
+
+      getMonotonicTime(&waitStart);
+      acquireLock(lock, options);
+      contended = 1;
+    }
+
+    recordLockAcquisition(lock, lock->name, (contended? &waitStart: NULL),
+                          !!(options & LOCK_Exclusive));
+    return 1;
+  }
+
+  return acquireLock(lock, options);
+}
+
+void
+releaseLock (LockDescriptor *lock) {
+  if (isLockProfilingEnabled()) recordLockRelease(lock);
+  relinquishLock(lock);
+}
+
 LockDescriptor *
 newLockDescriptor (void) {
   LockDescriptor *lock;
@@ -198,6 +229,7 @@ getLockDescriptor (LockDescriptor **lock, const char *name) {
   pthread_mutex_lock(&mutex);
     if (!*lock) {
       if ((*lock = newLockDescriptor())) {
+        (*lock)->name = name;
         isNew = 1;
       }
     }
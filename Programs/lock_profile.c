@@ -0,0 +1,306 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "log.h"
+#include "lock_profile.h"
+#include "addresses.h"
+#include "strfmt.h"
+#include "thread.h"
+#include "program.h"
+
+/* When the "locks" log category is enabled, obtainLock() and lockMutex()
+ * report each acquisition here. An acquisition is contended if the lock
+ * couldn't be taken without waiting, in which case the wait is added to a
+ * histogram whose buckets are powers of two microseconds. Hold times are
+ * only measured for exclusive acquisitions, and a recursive mutex is held
+ * from its outermost lock until its outermost unlock.
+ */
+
+#define PROFILE_TABLE_SIZE 0X100
+#define WAIT_BUCKET_COUNT 16
+
+typedef struct {
+  void *lock;
+  const char *name;
+
+  unsigned long int acquisitions;
+  unsigned long int contentions;
+  unsigned long long int totalWait;
+  unsigned long int maximumWait;
+  unsigned long int maximumHold;
+  unsigned long int waitBuckets[WAIT_BUCKET_COUNT];
+
+  TimeValue holdStart;
+  unsigned int holdDepth;
+} ProfileEntry;
+
+static CriticalSectionLock profileLock = CRITICAL_SECTION_LOCK_INITIALIZER;
+static ProfileEntry profileTable[PROFILE_TABLE_SIZE];
+static unsigned int profileCount = 0;
+static unsigned long int profileOverflows = 0;
+
+static void
+exitLockProfile (void *data) {
+  int profiled;
+
+  enterCriticalSection(&profileLock);
+    profiled = profileCount > 0;
+  leaveCriticalSection(&profileLock);
+
+  if (profiled) logLockProfile(PROFILE_TABLE_SIZE);
+}
+
+void
+beginLockProfile (void) {
+  onProgramExit("lock-profile", exitLockProfile, NULL);
+}
+
+static ProfileEntry *
+findProfileEntry (void *lock, int add) {
+  unsigned int index = ((uintptr_t)lock >> 3) % PROFILE_TABLE_SIZE;
+  unsigned int probes = PROFILE_TABLE_SIZE;
+
+  while (probes--) {
+    ProfileEntry *entry = &profileTable[index];
+
+    if (entry->lock == lock) return entry;
+
+    if (!entry->lock) {
+      if (!add) break;
+      if (profileCount == (PROFILE_TABLE_SIZE / 4 * 3)) break;
+      profileCount += 1;
+
+      entry->lock = lock;
+      return entry;
+    }
+
+    if (++index == PROFILE_TABLE_SIZE) index = 0;
+  }
+
+  if (add) profileOverflows += 1;
+  return NULL;
+}
+
+static unsigned long int
+getElapsedMicroseconds (const TimeValue *from, const TimeValue *to) {
+  return ((to->seconds - from->seconds) * USECS_PER_SEC)
+       + ((to->nanoseconds - from->nanoseconds) / NSECS_PER_USEC);
+}
+
+static unsigned int
+getWaitBucket (unsigned long int microseconds) {
+  unsigned int bucket = 0;
+
+  while ((microseconds >>= 1) && (bucket < (WAIT_BUCKET_COUNT - 1))) bucket += 1;
+  return bucket;
+}
+
+void
+recordLockAcquisition (void *lock, const char *name, const TimeValue *waitStart, int exclusive) {
+  TimeValue now;
+
+  getMonotonicTime(&now);
+
+  enterCriticalSection(&profileLock);
+  {
+    ProfileEntry *entry = findProfileEntry(lock, 1);
+
+    if (entry) {
+      if (name) entry->name = name;
+      entry->acquisitions += 1;
+
+      if (waitStart) {
+        unsigned long int microseconds = getElapsedMicroseconds(waitStart, &now);
+
+        entry->contentions += 1;
+        entry->totalWait += microseconds;
+        if (microseconds > entry->maximumWait) entry->maximumWait = microseconds;
+        entry->waitBuckets[getWaitBucket(microseconds)] += 1;
+      }
+
+      if (exclusive) {
+        if (!entry->holdDepth++) entry->holdStart = now;
+      }
+    }
+  }
+  leaveCriticalSection(&profileLock);
+}
+
+void
+recordLockRelease (void *lock) {
+  enterCriticalSection(&profileLock);
+  {
+    ProfileEntry *entry = findProfileEntry(lock, 0);
+
+    if (entry && entry->holdDepth) {
+      if (!--entry->holdDepth) {
+        TimeValue now;
+        unsigned long int microseconds;
+
+        getMonotonicTime(&now);
+        microseconds = getElapsedMicroseconds(&entry->holdStart, &now);
+        if (microseconds > entry->maximumHold) entry->maximumHold = microseconds;
+      }
+    }
+  }
+  leaveCriticalSection(&profileLock);
+}
+
+static int
+sortProfileEntries (const void *element1, const void *element2) {
+  const ProfileEntry *entry1 = element1;
+  const ProfileEntry *entry2 = element2;
+
+  if (entry1->totalWait > entry2->totalWait) return -1;
+  if (entry1->totalWait < entry2->totalWait) return 1;
+
+  if (entry1->acquisitions > entry2->acquisitions) return -1;
+  if (entry1->acquisitions < entry2->acquisitions) return 1;
+  return 0;
+}
+
+static void
+logProfileEntry (const ProfileEntry *entry) {
+  char name[0X80];
+  char histogram[0X100];
+
+  if (entry->name) {
+    snprintf(name, sizeof(name), "%s", entry->name);
+  } else {
+    ptrdiff_t offset;
+    const char *symbol = getAddressName(entry->lock, &offset);
+
+    if (symbol && !offset) {
+      snprintf(name, sizeof(name), "%s", symbol);
+    } else {
+      snprintf(name, sizeof(name), "%p", entry->lock);
+    }
+  }
+
+  {
+    STR_BEGIN(histogram, sizeof(histogram));
+
+    for (unsigned int bucket=0; bucket<WAIT_BUCKET_COUNT; bucket+=1) {
+      unsigned long int count = entry->waitBuckets[bucket];
+
+      if (count) {
+        if (STR_LENGTH) STR_PRINTF(" ");
+
+        if (bucket == (WAIT_BUCKET_COUNT - 1)) {
+          STR_PRINTF(">=%luus:%lu", (1UL << bucket), count);
+        } else {
+          STR_PRINTF("<%luus:%lu", (2UL << bucket), count);
+        }
+      }
+    }
+
+    if (!STR_LENGTH) STR_PRINTF("none");
+    STR_END;
+  }
+
+  logMessage(LOG_NOTICE,
+             "%s: acquired:%lu contended:%lu wait:%llums max-wait:%luus max-hold:%luus waits:%s",
+             name, entry->acquisitions, entry->contentions,
+             entry->totalWait / USECS_PER_MSEC,
+             entry->maximumWait, entry->maximumHold, histogram);
+}
+
+void
+logLockProfile (unsigned int count) {
+  ProfileEntry *entries;
+  unsigned int entryCount = 0;
+  unsigned long int overflows;
+
+  if (!(entries = malloc(sizeof(profileTable)))) {
+    logMallocError();
+    return;
+  }
+
+  enterCriticalSection(&profileLock);
+  {
+    for (unsigned int index=0; index<PROFILE_TABLE_SIZE; index+=1) {
+      const ProfileEntry *entry = &profileTable[index];
+      if (entry->lock) entries[entryCount++] = *entry;
+    }
+
+    overflows = profileOverflows;
+  }
+  leaveCriticalSection(&profileLock);
+
+  if (entryCount) {
+    qsort(entries, entryCount, sizeof(*entries), sortProfileEntries);
+    if (count > entryCount) count = entryCount;
+
+    logMessage(LOG_NOTICE,
+               "lock profile: top %u of %u locks (%lu not tracked)",
+               count, entryCount, overflows);
+
+    for (unsigned int index=0; index<count; index+=1) {
+      logProfileEntry(&entries[index]);
+    }
+  } else if (!isLockProfilingEnabled()) {
+    logMessage(LOG_NOTICE, "lock profiling isn't enabled");
+  } else {
+    logMessage(LOG_NOTICE, "no locks have been profiled");
+  }
+
+  free(entries);
+}
+
+void
+resetLockHoldState (void) {
+  enterCriticalSection(&profileLock);
+  {
+    for (unsigned int index=0; index<PROFILE_TABLE_SIZE; index+=1) {
+      profileTable[index].holdDepth = 0;
+    }
+  }
+  leaveCriticalSection(&profileLock);
+}
+
+void
+resetLockProfile (void) {
+  enterCriticalSection(&profileLock);
+  {
+    for (unsigned int index=0; index<PROFILE_TABLE_SIZE; index+=1) {
+      ProfileEntry *entry = &profileTable[index];
+
+      if (entry->lock) {
+        /* the hold state of a lock which is currently held must survive */
+        void *lock = entry->lock;
+        const char *name = entry->name;
+        TimeValue holdStart = entry->holdStart;
+        unsigned int holdDepth = entry->holdDepth;
+
+        memset(entry, 0, sizeof(*entry));
+        entry->lock = lock;
+        entry->name = name;
+        entry->holdStart = holdStart;
+        entry->holdDepth = holdDepth;
+      }
+    }
+
+    profileOverflows = 0;
+  }
+  leaveCriticalSection(&profileLock);
+}
@@ -49,6 +49,7 @@ const unsigned int logLevelCount = ARRAY_COUNT(logLevelNames);
 
 unsigned char systemLogLevel = LOG_NOTICE;
 unsigned char stderrLogLevel = LOG_NOTICE;
+unsigned char syncLogLevel = LOG_ERR; /* written to the log file right away */
 
 typedef struct {
   const char *name;
@@ -117,6 +118,18 @@ static const LogCategoryEntry logCategoryTable[LOG_CATEGORY_COUNT] = {
     .prefix = "async"
   },
 
+  [LOG_CATEGORY_INDEX(ASYNC_PROFILE)] = {
+    .name = "profile",
+    .title = strtext("Callback Profiling"),
+    .prefix = "profile"
+  },
+
+  [LOG_CATEGORY_INDEX(LOCK_PROFILE)] = {
+    .name = "locks",
+    .title = strtext("Lock Contention"),
+    .prefix = "locks"
+  },
+
   [LOG_CATEGORY_INDEX(SERVER_EVENTS)] = {
     .name = "server",
     .title = strtext("Server Events"),
@@ -268,8 +281,296 @@ popLogPrefix (void) {
   return popLogEntry(&logPrefixStack);
 }
 
+static size_t
+formatLogRecordHeader (char *buffer, size_t size, const TimeValue *time, const char *thread) {
+  size_t length;
+
+  STR_BEGIN(buffer, size);
+
+  {
+    char timestamp[0X20];
+    size_t length = formatSeconds(timestamp, sizeof(timestamp), "%Y-%m-%d@%H:%M:%S", time->seconds);
+    unsigned int milliseconds = time->nanoseconds / NSECS_PER_MSEC;
+
+    STR_PRINTF("%.*s.%03u ", (int)length, timestamp, milliseconds);
+  }
+
+  if (*thread) STR_PRINTF("[%s] ", thread);
+
+  length = STR_LENGTH;
+  STR_END;
+  return length;
+}
+
+#if defined(GOT_PTHREADS) && defined(__ATOMIC_ACQ_REL) && !defined(__MINGW32__)
+#define LOG_FILE_USE_RING
+
+/* Records destined for the log file are queued in a bounded multi-producer
+ * ring (sequence numbered slots, so producers never block) and written in
+ * batches by a background thread. The writer wakes up periodically, or early
+ * when a producer sees the ring filling up, rather than for every record.
+ * A record which doesn't fit into a slot carries a copy.
+ *
+ * A record at or above syncLogLevel, as well as one which finds the ring
+ * full, drains the ring and is then written synchronously, so no record is
+ * ever dropped and the ones which matter most are already in the log file
+ * if the process then crashes. The ring is also drained when the log file is
+ * closed (and before a fork), but not from a fatal signal handler, so less
+ * severe records still queued at the time of a crash are lost.
+ */
+
+#include <sched.h>
+
+#define LOG_RING_SIZE 0X800
+#define LOG_RING_WAKEUP (LOG_RING_SIZE / 8)
+#define LOG_RING_TEXT_SIZE 0X100
+#define LOG_WRITER_INTERVAL 50 /* milliseconds */
+
+typedef struct {
+  unsigned long int sequence;
+  TimeValue time;
+  char *overflow;
+  char thread[0X20];
+  char text[LOG_RING_TEXT_SIZE];
+} LogRingSlot;
+
+static LogRingSlot logRing[LOG_RING_SIZE];
+static unsigned long int logRingHead = 0;
+static unsigned long int logRingTail = 0;
+static unsigned char logRingActive = 0;
+
+static pthread_mutex_t logWriterLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t logWriterCondition = PTHREAD_COND_INITIALIZER;
+static pthread_t logWriterThread;
+static unsigned char logWriterRunning = 0;
+static unsigned char logWriterWaiting = 0;
+static unsigned char logWriterStop = 0;
+
+static void
+initializeLogRing (void) {
+  for (unsigned int index=0; index<LOG_RING_SIZE; index+=1) {
+    LogRingSlot *slot = &logRing[index];
+
+    slot->sequence = index;
+    slot->overflow = NULL;
+  }
+
+  logRingHead = 0;
+  logRingTail = 0;
+}
+
+static int
+enqueueLogRecord (const char *record) {
+  unsigned long int position = __atomic_load_n(&logRingHead, __ATOMIC_RELAXED);
+
+  while (1) {
+    LogRingSlot *slot = &logRing[position % LOG_RING_SIZE];
+    unsigned long int sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+    long int difference = (long int)(sequence - position);
+
+    if (difference < 0) return 0;
+
+    if (difference > 0) {
+      position = __atomic_load_n(&logRingHead, __ATOMIC_RELAXED);
+    } else if (__atomic_compare_exchange_n(&logRingHead, &position, position+1,
+                                           1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      size_t length = strlen(record);
+
+      getCurrentTime(&slot->time);
+      if (!formatThreadName(slot->thread, sizeof(slot->thread))) slot->thread[0] = 0;
+
+      if (length < sizeof(slot->text)) {
+        memcpy(slot->text, record, length+1);
+        slot->overflow = NULL;
+      } else if ((slot->overflow = strdup(record))) {
+        slot->text[0] = 0;
+      } else {
+        memcpy(slot->text, record, sizeof(slot->text)-1);
+        slot->text[sizeof(slot->text)-1] = 0;
+      }
+
+      __atomic_store_n(&slot->sequence, position+1, __ATOMIC_RELEASE);
+
+      if (!((position + 1) % LOG_RING_WAKEUP)) {
+        if (__atomic_load_n(&logWriterWaiting, __ATOMIC_ACQUIRE)) {
+          pthread_cond_signal(&logWriterCondition);
+        }
+      }
+
+      return 1;
+    }
+  }
+}
+
+static int
+isLogRingEmpty (void) {
+  const LogRingSlot *slot = &logRing[logRingTail % LOG_RING_SIZE];
+
+  return __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != (logRingTail + 1);
+}
+
+/* The caller must hold logWriterLock. */
+static int
+drainLogRing (void) {
+  char batch[0X4000];
+  size_t length = 0;
+  int count = 0;
+
+  if (!logFile) return 0;
+  lockStream(logFile);
+
+  while (!isLogRingEmpty()) {
+    LogRingSlot *slot = &logRing[logRingTail % LOG_RING_SIZE];
+    const char *text = slot->overflow? slot->overflow: slot->text;
+    size_t textLength = strlen(text);
+
+    char header[0X80];
+    size_t headerLength = formatLogRecordHeader(header, sizeof(header), &slot->time, slot->thread);
+    size_t recordLength = headerLength + textLength + 1;
+
+    if ((length + recordLength) > sizeof(batch)) {
+      fwrite(batch, 1, length, logFile);
+      length = 0;
+    }
+
+    if (recordLength > sizeof(batch)) {
+      fprintf(logFile, "%s%s\n", header, text);
+    } else {
+      memcpy(&batch[length], header, headerLength);
+      length += headerLength;
+
+      memcpy(&batch[length], text, textLength);
+      length += textLength;
+      batch[length++] = '\n';
+    }
+
+    if (slot->overflow) {
+      free(slot->overflow);
+      slot->overflow = NULL;
+    }
+
+    __atomic_store_n(&slot->sequence, logRingTail+LOG_RING_SIZE, __ATOMIC_RELEASE);
+    logRingTail += 1;
+    count += 1;
+  }
+
+  if (length) fwrite(batch, 1, length, logFile);
+  if (count) flushStream(logFile);
+  unlockStream(logFile);
+  return count;
+}
+
+/* The caller must hold logWriterLock. A record which has been claimed but not
+ * yet filled in holds up the ones after it, so wait for those which were
+ * claimed before the call.
+ */
+static void
+flushLogRing (void) {
+  unsigned long int head = __atomic_load_n(&logRingHead, __ATOMIC_RELAXED);
+
+  while (logFile && ((long int)(head - logRingTail) > 0)) {
+    if (!drainLogRing()) sched_yield();
+  }
+}
+
+static THREAD_FUNCTION(runLogWriter) {
+  pthread_mutex_lock(&logWriterLock);
+
+  while (!logWriterStop) {
+    struct timespec timeout;
+
+    drainLogRing();
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+    timeout.tv_nsec += LOG_WRITER_INTERVAL * NSECS_PER_MSEC;
+
+    if (timeout.tv_nsec >= NSECS_PER_SEC) {
+      timeout.tv_sec += 1;
+      timeout.tv_nsec -= NSECS_PER_SEC;
+    }
+
+    /* a wakeup which races with going to sleep is covered by the timeout */
+    __atomic_store_n(&logWriterWaiting, 1, __ATOMIC_SEQ_CST);
+    if (!logWriterStop) pthread_cond_timedwait(&logWriterCondition, &logWriterLock, &timeout);
+    __atomic_store_n(&logWriterWaiting, 0, __ATOMIC_RELEASE);
+  }
+
+  drainLogRing();
+  pthread_mutex_unlock(&logWriterLock);
+  return NULL;
+}
+
+static void
+startLogWriter (void) {
+  if (!logWriterRunning) {
+    logWriterStop = 0;
+    if (createThread("log-writer", &logWriterThread, NULL, runLogWriter, NULL)) return;
+    logWriterRunning = 1;
+  }
+
+  __atomic_store_n(&logRingActive, 1, __ATOMIC_RELEASE);
+}
+
+static void
+stopLogWriter (void) {
+  __atomic_store_n(&logRingActive, 0, __ATOMIC_RELEASE);
+
+  if (logWriterRunning) {
+    pthread_mutex_lock(&logWriterLock);
+    logWriterStop = 1;
+    pthread_cond_signal(&logWriterCondition);
+    pthread_mutex_unlock(&logWriterLock);
+
+    pthread_join(logWriterThread, NULL);
+    logWriterRunning = 0;
+  }
+
+  pthread_mutex_lock(&logWriterLock);
+  drainLogRing();
+  pthread_mutex_unlock(&logWriterLock);
+}
+
+static void
+prepareLogFork (void) {
+  pthread_mutex_lock(&logWriterLock);
+  drainLogRing();
+}
+
+static void
+resumeLogParent (void) {
+  pthread_mutex_unlock(&logWriterLock);
+}
+
+static void
+resumeLogChild (void) {
+  /* The writer thread doesn't exist in the child, so records are written
+   * synchronously until resumeLogWriter() is called.
+   */
+  pthread_mutex_init(&logWriterLock, NULL);
+  logWriterRunning = 0;
+  logWriterWaiting = 0;
+  logRingActive = 0;
+}
+
+static void
+prepareLogRing (void) {
+  static int prepared = 0;
+
+  if (!prepared) {
+    prepared = 1;
+    pthread_atfork(prepareLogFork, resumeLogParent, resumeLogChild);
+  }
+
+  initializeLogRing();
+}
+#endif /* LOG_FILE_USE_RING */
+
 void
 closeLogFile (void) {
+#ifdef LOG_FILE_USE_RING
+  stopLogWriter();
+#endif /* LOG_FILE_USE_RING */
+
   if (logFile) {
     fclose(logFile);
     logFile = NULL;
@@ -279,34 +580,35 @@ closeLogFile (void) {
 void
 openLogFile (const char *path) {
   closeLogFile();
-  logFile = fopen(path, "w");
+
+  if ((logFile = fopen(path, "w"))) {
+#ifdef LOG_FILE_USE_RING
+    prepareLogRing();
+    startLogWriter();
+#endif /* LOG_FILE_USE_RING */
+  }
+}
+
+void
+resumeLogWriter (void) {
+#ifdef LOG_FILE_USE_RING
+  if (logFile) startLogWriter();
+#endif /* LOG_FILE_USE_RING */
 }
 
 static void
-writeLogRecord (const char *record) {
+writeLogFile (const char *record) {
   if (logFile) {
-    lockStream(logFile);
-
-    {
-      TimeValue now;
-      char buffer[0X20];
-      size_t length;
-      unsigned int milliseconds;
-
-      getCurrentTime(&now);
-      length = formatSeconds(buffer, sizeof(buffer), "%Y-%m-%d@%H:%M:%S", now.seconds);
-      milliseconds = now.nanoseconds / NSECS_PER_MSEC;
-
-      fprintf(logFile, "%.*s.%03u ", (int)length, buffer, milliseconds);
-    }
-
-    {
-      char name[0X40];
-      size_t length = formatThreadName(name, sizeof(name));
+    TimeValue now;
+    char thread[0X40];
+    char header[0X80];
 
-      if (length) fprintf(logFile, "[%s] ", name);
-    }
+    getCurrentTime(&now);
+    if (!formatThreadName(thread, sizeof(thread))) thread[0] = 0;
+    formatLogRecordHeader(header, sizeof(header), &now, thread);
 
+    lockStream(logFile);
+    fputs(header, logFile);
     fputs(record, logFile);
     fputc('\n', logFile);
     flushStream(logFile);
@@ -314,6 +616,26 @@ writeLogRecord (const char *record) {
   }
 }
 
+static void
+writeLogRecord (int level, const char *record) {
+#ifdef LOG_FILE_USE_RING
+  if (__atomic_load_n(&logRingActive, __ATOMIC_ACQUIRE)) {
+    if (level > syncLogLevel) {
+      if (enqueueLogRecord(record)) return;
+    }
+
+    /* queued records go out first so that the log file stays in order */
+    pthread_mutex_lock(&logWriterLock);
+    flushLogRing();
+    writeLogFile(record);
+    pthread_mutex_unlock(&logWriterLock);
+    return;
+  }
+#endif /* LOG_FILE_USE_RING */
+
+  writeLogFile(record);
+}
+
 void
 openSystemLog (void) {
 #if defined(WINDOWS)
@@ -392,7 +714,7 @@ logData (int level, LogDataFormatter *formatLogData, const void *data) {
       STR_END;
 
       if (write) {
-        writeLogRecord(record);
+        writeLogRecord(level, record);
 
 #if defined(WINDOWS)
         if (windowsEventLog != INVALID_HANDLE_VALUE) {
@@ -384,6 +384,12 @@ changedSkipIdenticalLines (const MenuItem *item, unsigned char setting UNUSED) {
   return 1;
 }
 
+static int
+changedLockProfiling (const MenuItem *item, unsigned char setting UNUSED) {
+  updateLockProfiling();
+  return 1;
+}
+
 static int
 changedTextTable (const MenuItem *item, unsigned char setting UNUSED) {
   return changeTextTable(getMenuItemValue(item));
@@ -799,6 +805,21 @@ makePreferencesMenu (void) {
       ITEM(newBooleanMenuItem(navigationSubmenu, &prefs.trackScreenScroll, &itemName));
     }
 
+    {
+      NAME(strtext("Case-sensitive Search"));
+      ITEM(newBooleanMenuItem(navigationSubmenu, &prefs.caseSensitiveSearch, &itemName));
+    }
+
+    {
+      NAME(strtext("Regular Expression Search"));
+      ITEM(newBooleanMenuItem(navigationSubmenu, &prefs.regularExpressionSearch, &itemName));
+    }
+
+    {
+      NAME(strtext("Screen History"));
+      ITEM(newBooleanMenuItem(navigationSubmenu, &prefs.screenHistory, &itemName));
+    }
+
 #ifdef HAVE_LIBGPM
     {
       NAME(strtext("Track Screen Pointer"));
@@ -1427,6 +1448,10 @@ makePreferencesMenu (void) {
                   TEST(KeyboardTable);
                   break;
 
+                case LOG_CATEGORY_INDEX(LOCK_PROFILE):
+                  CHANGED(LockProfiling);
+                  break;
+
                 default:
                   break;
               }
@@ -43,11 +43,20 @@ extern "C" {
 
 #define SPEECH_RESPONSE_WAIT_TIMEOUT 5000
 
+#define SPEECH_CHUNK_THRESHOLD 0X100
+#define SPEECH_CHUNK_FIRST_LIMIT 0X40
+#define SPEECH_CHUNK_LIMIT 0X100
+#define SPEECH_CHUNK_QUEUE_SIZE 0X40
+
 #define SCREEN_DRIVER_START_RETRY_INTERVAL 5000
 #define SCREEN_FREEZE_REMINDER_INTERVAL 30000
 #define SCREEN_UPDATE_POLL_INTERVAL 40
 #define SCREEN_UPDATE_SCHEDULE_DELAY 5
 
+#define SCREEN_HISTORY_MEMORY_LIMIT 0X100000
+#define SCREEN_HISTORY_FRAME_LIMIT 0X400
+#define SCREEN_HISTORY_KEYFRAME_INTERVAL 16
+
 #define KEYBOARD_MONITOR_START_RETRY_INTERVAL 5000
 
 #define PID_FILE_CREATE_RETRY_INTERVAL 5000
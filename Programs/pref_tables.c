@@ -307,6 +307,24 @@ const PreferenceDefinition preferenceDefinitionTable[] = {
     .setting = &prefs.trackScreenScroll
   },
 
+  { .name = "case-sensitive-search",
+    .defaultValue = DEFAULT_CASE_SENSITIVE_SEARCH,
+    .settingNames = &preferenceStringTable_boolean,
+    .setting = &prefs.caseSensitiveSearch
+  },
+
+  { .name = "regular-expression-search",
+    .defaultValue = DEFAULT_REGULAR_EXPRESSION_SEARCH,
+    .settingNames = &preferenceStringTable_boolean,
+    .setting = &prefs.regularExpressionSearch
+  },
+
+  { .name = "screen-history",
+    .defaultValue = DEFAULT_SCREEN_HISTORY,
+    .settingNames = &preferenceStringTable_boolean,
+    .setting = &prefs.screenHistory
+  },
+
   { .name = "track-screen-pointer",
     .defaultValue = DEFAULT_TRACK_SCREEN_POINTER,
     .settingNames = &preferenceStringTable_boolean,
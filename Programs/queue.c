@@ -18,30 +18,14 @@
 
 #include "prologue.h"
 
+#include <string.h>
+
 #include "log.h"
 #include "queue.h"
 #include "lock.h"
+#include "thread.h"
 #include "program.h"
 
-static Element *discardedElements = NULL;
-
-static LockDescriptor *
-getDiscardedElementsLock (void) {
-  static LockDescriptor *lock = NULL;
-
-  return getLockDescriptor(&lock, "queue-discarded-elements");
-}
-
-static void
-lockDiscardedElements (void) {
-  obtainExclusiveLock(getDiscardedElementsLock());
-}
-
-static void
-unlockDiscardedElements (void) {
-  releaseLock(getDiscardedElementsLock());
-}
-
 struct QueueStruct {
   Element *head;
   unsigned int size;
@@ -87,43 +71,250 @@ removeItem (Element *element) {
   }
 }
 
+/* Elements are carved out of slabs and, once discarded, are recycled via a
+ * shared pool. When thread-local variables are available, each thread also
+ * keeps a small cache of its own so that the pool's lock is only taken for
+ * batches of elements rather than for each one.
+ */
+
+#define ELEMENT_SLAB_SIZE 0X100
+#define ELEMENT_BATCH_SIZE 0X20
+#define ELEMENT_CACHE_LIMIT (ELEMENT_BATCH_SIZE * 2)
+
+typedef struct ElementSlabStruct ElementSlab;
+
+struct ElementSlabStruct {
+  ElementSlab *next;
+  Element elements[ELEMENT_SLAB_SIZE];
+};
+
+static struct {
+  Element *elements;
+  unsigned int count;
+
+  ElementSlab *slabs;
+  unsigned int total;
+
+  QueueStatistics statistics;
+} elementPool = {
+  .elements = NULL,
+  .count = 0,
+
+  .slabs = NULL,
+  .total = 0
+};
+
+static LockDescriptor *
+getElementPoolLock (void) {
+  static LockDescriptor *lock = NULL;
+
+  return getLockDescriptor(&lock, "queue-element-pool");
+}
+
+static void
+lockElementPool (void) {
+  LockDescriptor *lock = getElementPoolLock();
+
+  if (!tryExclusiveLock(lock)) {
+    obtainExclusiveLock(lock);
+    elementPool.statistics.lockContentions += 1;
+  }
+
+  elementPool.statistics.lockAcquisitions += 1;
+}
+
+static void
+unlockElementPool (void) {
+  releaseLock(getElementPoolLock());
+}
+
+static int
+addElementSlab (void) {
+  ElementSlab *slab;
+
+  if (!(slab = malloc(sizeof(*slab)))) {
+    logMallocError();
+    return 0;
+  }
+
+  slab->next = elementPool.slabs;
+  elementPool.slabs = slab;
+
+  for (unsigned int index=0; index<ELEMENT_SLAB_SIZE; index+=1) {
+    Element *element = &slab->elements[index];
+
+    element->next = elementPool.elements;
+    elementPool.elements = element;
+  }
+
+  elementPool.count += ELEMENT_SLAB_SIZE;
+  elementPool.total += ELEMENT_SLAB_SIZE;
+  elementPool.statistics.slabAllocations += 1;
+  return 1;
+}
+
+static unsigned int
+takePooledElements (Element **elements, unsigned int count) {
+  unsigned int taken = 0;
+
+  lockElementPool();
+    while (taken < count) {
+      Element *element = elementPool.elements;
+
+      if (!element) {
+        if (!addElementSlab()) break;
+        element = elementPool.elements;
+      }
+
+      elementPool.elements = element->next;
+      elementPool.count -= 1;
+
+      element->next = *elements;
+      *elements = element;
+      taken += 1;
+    }
+
+    elementPool.statistics.elementsTaken += taken;
+  unlockElementPool();
+
+  return taken;
+}
+
+static void
+returnPooledElements (Element *first, Element *last, unsigned int count) {
+  lockElementPool();
+    last->next = elementPool.elements;
+    elementPool.elements = first;
+    elementPool.count += count;
+    elementPool.statistics.elementsReturned += count;
+  unlockElementPool();
+}
+
+#ifdef THREAD_LOCAL
+typedef struct {
+  Element *elements;
+  unsigned int count;
+} ElementCache;
+
+static void
+flushElementCache (ElementCache *cache, unsigned int keep) {
+  if (cache->count > keep) {
+    unsigned int count = cache->count - keep;
+    Element *first = cache->elements;
+    Element *last = first;
+
+    for (unsigned int index=1; index<count; index+=1) last = last->next;
+    cache->elements = last->next;
+    cache->count = keep;
+
+    returnPooledElements(first, last, count);
+  }
+}
+
+static THREAD_SPECIFIC_DATA_NEW(tsdElementCache) {
+  ElementCache *cache;
+
+  if ((cache = malloc(sizeof(*cache)))) {
+    memset(cache, 0, sizeof(*cache));
+    cache->elements = NULL;
+    cache->count = 0;
+    return cache;
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+static THREAD_LOCAL ElementCache *elementCache = NULL;
+
+static THREAD_SPECIFIC_DATA_DESTROY(tsdElementCache) {
+  ElementCache *cache = data;
+
+  if (cache) {
+    flushElementCache(cache, 0);
+    free(cache);
+    elementCache = NULL;
+  }
+}
+
+THREAD_SPECIFIC_DATA_CONTROL(tsdElementCache);
+
+static ElementCache *
+getElementCache (void) {
+  if (!elementCache) elementCache = getThreadSpecificData(&tsdElementCache);
+  return elementCache;
+}
+#endif /* THREAD_LOCAL */
+
 static void
 discardElement (Element *element) {
   removeItem(element);
   removeElement(element);
 
-  lockDiscardedElements();
-    element->next = discardedElements;
-    discardedElements = element;
-  unlockDiscardedElements();
+#ifdef THREAD_LOCAL
+  {
+    ElementCache *cache = getElementCache();
+
+    if (cache) {
+      element->next = cache->elements;
+      cache->elements = element;
+      cache->count += 1;
+
+      if (cache->count > ELEMENT_CACHE_LIMIT) {
+        flushElementCache(cache, ELEMENT_CACHE_LIMIT - ELEMENT_BATCH_SIZE);
+      }
+
+      return;
+    }
+  }
+#endif /* THREAD_LOCAL */
+
+  returnPooledElements(element, element, 1);
 }
 
 static Element *
 retrieveElement (void) {
-  Element *element;
+  Element *element = NULL;
+
+#ifdef THREAD_LOCAL
+  {
+    ElementCache *cache = getElementCache();
 
-  lockDiscardedElements();
-    if ((element = discardedElements)) {
-      discardedElements = element->next;
-      element->next = NULL;
+    if (cache) {
+      if (!cache->count) {
+        cache->count = takePooledElements(&cache->elements, ELEMENT_BATCH_SIZE);
+      }
+
+      if ((element = cache->elements)) {
+        cache->elements = element->next;
+        cache->count -= 1;
+      }
+
+      return element;
     }
-  unlockDiscardedElements();
+  }
+#endif /* THREAD_LOCAL */
 
+  takePooledElements(&element, 1);
   return element;
 }
 
+void
+getQueueStatistics (QueueStatistics *statistics) {
+  lockElementPool();
+    *statistics = elementPool.statistics;
+    statistics->elementsAllocated = elementPool.total;
+    statistics->elementsPooled = elementPool.count;
+  unlockElementPool();
+}
+
 static Element *
 newElement (Queue *queue, void *item) {
   Element *element;
 
-  if (!(element = retrieveElement())) {
-    if (!(element = malloc(sizeof(*element)))) {
-      logMallocError();
-      return NULL;
-    }
-
-    element->previous = element->next = NULL;
-  }
+  if (!(element = retrieveElement())) return NULL;
+  element->previous = element->next = NULL;
 
   addElement(queue, element);
   element->item = item;
@@ -258,13 +449,24 @@ static int queueInitialized = 0;
 
 static void
 exitQueue (void *data) {
-  lockDiscardedElements();
-    while (discardedElements) {
-      Element *element = discardedElements;
-      discardedElements = element->next;
-      free(element);
+#ifdef THREAD_LOCAL
+  if (elementCache) flushElementCache(elementCache, 0);
+#endif /* THREAD_LOCAL */
+
+  lockElementPool();
+    /* elements cached by other threads might still be in use */
+    if (elementPool.count == elementPool.total) {
+      while (elementPool.slabs) {
+        ElementSlab *slab = elementPool.slabs;
+        elementPool.slabs = slab->next;
+        free(slab);
+      }
+
+      elementPool.elements = NULL;
+      elementPool.count = 0;
+      elementPool.total = 0;
     }
-  unlockDiscardedElements();
+  unlockElementPool();
 
   queueInitialized = 0;
 }
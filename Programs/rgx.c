@@ -190,7 +190,7 @@ rgxTestMatcher (const void *item, void *data) {
 
   int error;
   int matched = rgxMatchText(
-    match->text.internal, match->text.length,
+    match->text.internal, match->text.length, match->text.offset,
     matcher->compiled.code, matcher->compiled.data,
     matcher->options, &match->capture.count, &error
   );
@@ -211,18 +211,20 @@ rgxTestMatcher (const void *item, void *data) {
 }
 
 RGX_Matcher *
-rgxMatchTextCharacters (
+rgxMatchTextCharactersFrom (
   RGX_Object *rgx,
-  const wchar_t *characters, size_t length,
+  const wchar_t *characters, size_t length, size_t offset,
   RGX_Match **result, void *data
 ) {
+  if (offset > length) return NULL;
   RGX_CHARACTERS_TO_INTERNAL;
 
   RGX_Match match = {
     .text = {
       .internal = internal,
       .characters = characters,
-      .length = length
+      .length = length,
+      .offset = offset
     },
 
     .data = {
@@ -262,6 +264,15 @@ rgxMatchTextCharacters (
   return getElementItem(element);
 }
 
+RGX_Matcher *
+rgxMatchTextCharacters (
+  RGX_Object *rgx,
+  const wchar_t *characters, size_t length,
+  RGX_Match **result, void *data
+) {
+  return rgxMatchTextCharactersFrom(rgx, characters, length, 0, result, data);
+}
+
 RGX_Matcher *
 rgxMatchTextString (
   RGX_Object *rgx,
@@ -81,7 +81,7 @@ extern RGX_DataType *rgxAllocateData (RGX_CodeType *code);
 extern void rgxDeallocateData (RGX_DataType *data);
 
 extern int rgxMatchText (
-  const RGX_CharacterType *characters, size_t length,
+  const RGX_CharacterType *characters, size_t length, size_t offset,
   RGX_CodeType *code, RGX_DataType *data,
   RGX_OptionsType options, size_t *count, int *error
 );
@@ -28,9 +28,13 @@ rgxCompilePattern (
   RGX_OptionsType options, RGX_OffsetType *offset,
   int *error
 ) {
-  return pcre2_compile(
+  RGX_CodeType *code = pcre2_compile(
     characters, length, options, error, offset, NULL
   );
+
+  /* the interpreter is used if just-in-time compilation isn't available */
+  if (code) pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+  return code;
 }
 
 void
@@ -50,12 +54,12 @@ rgxDeallocateData (RGX_DataType *data) {
 
 int
 rgxMatchText (
-  const RGX_CharacterType *characters, size_t length,
+  const RGX_CharacterType *characters, size_t length, size_t offset,
   RGX_CodeType *code, RGX_DataType *data,
   RGX_OptionsType options, size_t *count, int *error
 ) {
   int result = pcre2_match(
-    code, characters, length, 0, options, data, NULL
+    code, characters, length, offset, options, data, NULL
   );
 
   if (result < 0) {
@@ -80,7 +80,13 @@ rgxAllocateData (RGX_CodeType *code) {
 
   {
     const char *message = NULL;
-    data->study = pcre32_study(code, 0, &message);
+    int options = 0;
+
+#ifdef PCRE_STUDY_JIT_COMPILE
+    options |= PCRE_STUDY_JIT_COMPILE;
+#endif /* PCRE_STUDY_JIT_COMPILE */
+
+    data->study = pcre32_study(code, options, &message);
 
     if (message) {
       logMessage(LOG_WARNING, "pcre study error: %s", message);
@@ -103,14 +109,14 @@ rgxDeallocateData (RGX_DataType *data) {
 
 int
 rgxMatchText (
-  const RGX_CharacterType *characters, size_t length,
+  const RGX_CharacterType *characters, size_t length, size_t offset,
   RGX_CodeType *code, RGX_DataType *data,
   RGX_OptionsType options, size_t *count, int *error
 ) {
   int result = pcre32_exec(
     code, data->study,
     characters, length,
-    0, options,
+    offset, options,
     data->offsets, data->count
   );
 
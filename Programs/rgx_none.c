@@ -46,7 +46,7 @@ rgxDeallocateData (RGX_DataType *data) {
 
 int
 rgxMatchText (
-  const RGX_CharacterType *characters, size_t length,
+  const RGX_CharacterType *characters, size_t length, size_t offset,
   RGX_CodeType *code, RGX_DataType *data,
   RGX_OptionsType options, size_t *count, int *error
 ) {
@@ -103,6 +103,124 @@ describeScreen (ScreenDescription *description) {
   describeBaseScreen(currentScreen, description);
 }
 
+/* While an update is in progress, whole rows read from the current screen
+ * are kept so that every consumer within that update (braille window,
+ * autospeak, scroll tracking, status fields, etc) shares one driver read
+ * per row. Rows are only filled when first needed.
+ */
+
+typedef struct {
+  ScreenCharacter *characters;
+  unsigned long int generation;
+} ScreenSnapshotRow;
+
+static struct {
+  const BaseScreen *screen;
+  unsigned long int generation;
+
+  int columns;
+  int rows;
+
+  ScreenSnapshotRow *rowArray;
+  int rowCount;
+} snapshot = {
+  .generation = 1
+};
+
+static void
+discardSnapshotRows (void) {
+  while (snapshot.rowCount > 0) {
+    ScreenSnapshotRow *row = &snapshot.rowArray[--snapshot.rowCount];
+    if (row->characters) free(row->characters);
+  }
+
+  if (snapshot.rowArray) {
+    free(snapshot.rowArray);
+    snapshot.rowArray = NULL;
+  }
+}
+
+void
+beginScreenSnapshot (const ScreenDescription *description) {
+  snapshot.screen = NULL;
+  snapshot.generation += 1;
+  if (description->unreadable) return;
+
+  if (description->cols != snapshot.columns) {
+    discardSnapshotRows();
+    snapshot.columns = description->cols;
+  }
+
+  if (description->rows > snapshot.rowCount) {
+    ScreenSnapshotRow *rows = realloc(snapshot.rowArray, ARRAY_SIZE(rows, description->rows));
+
+    if (!rows) {
+      logMallocError();
+      return;
+    }
+
+    while (snapshot.rowCount < description->rows) {
+      ScreenSnapshotRow *row = &rows[snapshot.rowCount++];
+      row->characters = NULL;
+      row->generation = 0;
+    }
+
+    snapshot.rowArray = rows;
+  }
+
+  snapshot.rows = description->rows;
+  snapshot.screen = currentScreen;
+}
+
+void
+endScreenSnapshot (void) {
+  snapshot.screen = NULL;
+}
+
+static const ScreenCharacter *
+getSnapshotRow (int number) {
+  ScreenSnapshotRow *row = &snapshot.rowArray[number];
+
+  if (row->generation != snapshot.generation) {
+    if (!row->characters) {
+      if (!(row->characters = malloc(ARRAY_SIZE(row->characters, snapshot.columns)))) {
+        logMallocError();
+        return NULL;
+      }
+    }
+
+    {
+      const ScreenBox box = {
+        .left = 0, .width = snapshot.columns,
+        .top = number, .height = 1
+      };
+
+      if (!currentScreen->readCharacters(&box, row->characters)) return NULL;
+    }
+
+    row->generation = snapshot.generation;
+  }
+
+  return row->characters;
+}
+
+static int
+readSnapshot (const ScreenBox *box, ScreenCharacter *buffer) {
+  if (snapshot.screen != currentScreen) return 0;
+  if ((box->left < 0) || (box->width < 1) || ((box->left + box->width) > snapshot.columns)) return 0;
+  if ((box->top < 0) || (box->height < 1) || ((box->top + box->height) > snapshot.rows)) return 0;
+
+  for (int row=0; row<box->height; row+=1) {
+    const ScreenCharacter *characters = getSnapshotRow(box->top + row);
+    if (!characters) return 0;
+
+    memcpy(buffer, &characters[box->left], ARRAY_SIZE(buffer, box->width));
+    buffer += box->width;
+  }
+
+  return 1;
+}
+
 int
 readScreen (short left, short top, short width, short height, ScreenCharacter *buffer) {
   ScreenBox box;
@@ -110,6 +228,8 @@ readScreen (short left, short top, short width, short height, ScreenCharacter *b
   box.top = top;
   box.width = width;
   box.height = height;
+
+  if (readSnapshot(&box, buffer)) return 1;
   return currentScreen->readCharacters(&box, buffer);
 }
 
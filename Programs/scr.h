@@ -34,6 +34,8 @@ extern int pollScreen (void);
 extern int refreshScreen (void);
 extern void describeScreen (ScreenDescription *);		/* get screen status */
 extern int readScreen (short left, short top, short width, short height, ScreenCharacter *buffer);
+extern void beginScreenSnapshot (const ScreenDescription *description);
+extern void endScreenSnapshot (void);
 extern int readScreenText (short left, short top, short width, short height, wchar_t *buffer);
 extern int insertScreenKey (ScreenKey key);
 extern int routeScreenCursor (int column, int row, int screen);
@@ -242,6 +242,7 @@ describeBaseScreen (BaseScreen *base, ScreenDescription *description) {
   description->number = 0;
   description->cols = description->rows = 1;
   description->posx = description->posy = 0;
+  description->scrollback = 0;
 
   description->hasCursor = 1;
   description->hasSelection = 0;
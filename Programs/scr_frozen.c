@@ -27,9 +27,15 @@
 #include "alert.h"
 #include "scr.h"
 #include "scr_frozen.h"
+#include "scr_history.h"
+#include "scr_index.h"
 
 static ScreenDescription screenDescription;
 static ScreenCharacter *screenCharacters;
+static size_t screenSize;
+
+static unsigned long int imageSequence;
+static unsigned char haveImageSequence;
 
 static int startFreezeReminderAlarm (void);
 static AsyncHandle freezeReminderAlarm = NULL;
@@ -61,14 +67,20 @@ stopFreezeReminderAlarm (void) {
 static int
 construct_FrozenScreen (BaseScreen *source) {
   describeBaseScreen(source, &screenDescription);
+  screenSize = screenDescription.rows * screenDescription.cols;
 
-  if ((screenCharacters = calloc(screenDescription.rows*screenDescription.cols, sizeof(*screenCharacters)))) {
+  if ((screenCharacters = calloc(screenSize, sizeof(*screenCharacters)))) {
     const ScreenBox box = {
       .left=0, .width=screenDescription.cols,
       .top=0, .height=screenDescription.rows
     };
 
     if (source->readCharacters(&box, screenCharacters)) {
+      unsigned long int first;
+
+      /* the newest history image is now the same as this snapshot */
+      haveImageSequence = addScreenHistory(source) && getScreenHistoryRange(&first, &imageSequence);
+
       startFreezeReminderAlarm();
       return 1;
     }
@@ -116,6 +128,26 @@ currentVirtualTerminal_FrozenScreen (void) {
   return screenDescription.number;
 }
 
+static int
+selectImage_FrozenScreen (int offset) {
+  unsigned long int first;
+  unsigned long int last;
+
+  if (!haveImageSequence) return 0;
+  if (!getScreenHistoryRange(&first, &last)) return 0;
+
+  if (offset < 0) {
+    if ((imageSequence - first) < (unsigned long int)-offset) return 0;
+  } else {
+    if ((last - imageSequence) < (unsigned long int)offset) return 0;
+  }
+
+  if (!restoreScreenHistory(imageSequence+offset, &screenDescription, &screenCharacters, &screenSize)) return 0;
+  imageSequence += offset;
+  invalidateScreenRowIndex();
+  return 1;
+}
+
 void
 initializeFrozenScreen (FrozenScreen *frozen) {
   initializeBaseScreen(&frozen->base);
@@ -124,5 +156,6 @@ initializeFrozenScreen (FrozenScreen *frozen) {
   frozen->base.currentVirtualTerminal = currentVirtualTerminal_FrozenScreen;
   frozen->construct = construct_FrozenScreen;
   frozen->destruct = destruct_FrozenScreen;
+  frozen->selectImage = selectImage_FrozenScreen;
   screenCharacters = NULL;
 }
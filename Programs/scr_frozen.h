@@ -29,6 +29,7 @@ typedef struct {
   BaseScreen base;
   int (*construct) (BaseScreen *);		/* called every time the screen is frozen */
   void (*destruct) (void);		/* called to discard frozen screen image */
+  int (*selectImage) (int offset);		/* move through the screen history */
 } FrozenScreen;
 
 extern void initializeFrozenScreen (FrozenScreen *frozen);
@@ -0,0 +1,339 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "parameters.h"
+#include "scr_history.h"
+
+/* The history is a ring of screen images. A keyframe holds every row of
+ * its image, and each of the images which follow it holds only those rows
+ * which differ from its keyframe (not from its predecessor), so restoring
+ * any image costs one keyframe copy plus one delta. Whole keyframe groups
+ * are discarded, oldest first, to stay within the memory limit.
+ */
+
+typedef struct ScreenHistoryFrameStruct ScreenHistoryFrame;
+
+struct ScreenHistoryFrameStruct {
+  const ScreenHistoryFrame *keyframe; /* NULL if this is a keyframe */
+  size_t size;
+
+  ScreenDescription description;
+  unsigned int rowCount;
+  unsigned short *rowNumbers; /* NULL if this is a keyframe */
+  ScreenCharacter *characters;
+};
+
+static ScreenHistoryFrame *historyFrames[SCREEN_HISTORY_FRAME_LIMIT];
+static unsigned int historyStart = 0;
+static unsigned int historyCount = 0;
+static unsigned long int historyFirst = 0;
+static size_t historySize = 0;
+
+static const ScreenHistoryFrame *currentKeyframe = NULL;
+static unsigned int deltasSinceKeyframe = 0;
+
+static ScreenDescription latestDescription;
+static ScreenCharacter *latestCharacters = NULL;
+static ScreenCharacter *newCharacters = NULL;
+static size_t characterBufferSize = 0;
+static unsigned char haveLatest = 0;
+
+static ScreenHistoryFrame *
+getFrame (unsigned int index) {
+  return historyFrames[(historyStart + index) % SCREEN_HISTORY_FRAME_LIMIT];
+}
+
+static void
+removeOldestFrame (void) {
+  ScreenHistoryFrame *frame = getFrame(0);
+
+  if (frame == currentKeyframe) currentKeyframe = NULL;
+  historySize -= frame->size;
+  free(frame);
+
+  historyStart = (historyStart + 1) % SCREEN_HISTORY_FRAME_LIMIT;
+  historyCount -= 1;
+  historyFirst += 1;
+}
+
+static void
+removeOldestGroup (void) {
+  do {
+    removeOldestFrame();
+  } while (historyCount && getFrame(0)->keyframe);
+}
+
+void
+clearScreenHistory (void) {
+  while (historyCount) removeOldestFrame();
+  haveLatest = 0;
+}
+
+static int
+isSameDescription (const ScreenDescription *description1, const ScreenDescription *description2) {
+  return (description1->cols == description2->cols)
+      && (description1->rows == description2->rows)
+      && (description1->posx == description2->posx)
+      && (description1->posy == description2->posy)
+      && (description1->number == description2->number)
+      && (description1->hasCursor == description2->hasCursor);
+}
+
+static int
+isSameRow (const ScreenCharacter *row1, const ScreenCharacter *row2, int columns) {
+  return memcmp(row1, row2, ARRAY_SIZE(row1, columns)) == 0;
+}
+
+static int
+prepareCharacterBuffers (size_t count) {
+  if (count > characterBufferSize) {
+    ScreenCharacter *latest;
+    ScreenCharacter *new;
+
+    if (!(latest = malloc(ARRAY_SIZE(latest, count)))) goto noMemory;
+
+    if (!(new = malloc(ARRAY_SIZE(new, count)))) {
+      free(latest);
+      goto noMemory;
+    }
+
+    if (latestCharacters) free(latestCharacters);
+    latestCharacters = latest;
+
+    if (newCharacters) free(newCharacters);
+    newCharacters = new;
+
+    characterBufferSize = count;
+    haveLatest = 0;
+  }
+
+  return 1;
+
+noMemory:
+  logMallocError();
+  return 0;
+}
+
+static ScreenHistoryFrame *
+newFrame (const ScreenDescription *description, unsigned int rowCount, int isKeyframe) {
+  ScreenHistoryFrame *frame;
+  size_t numbersSize = isKeyframe? 0: ARRAY_SIZE(frame->rowNumbers, rowCount);
+  size_t charactersSize = ARRAY_SIZE(frame->characters, (rowCount * description->cols));
+  size_t size = sizeof(*frame) + numbersSize + charactersSize;
+
+  if (!(frame = malloc(size))) {
+    logMallocError();
+    return NULL;
+  }
+
+  memset(frame, 0, sizeof(*frame));
+  frame->size = size;
+  frame->description = *description;
+  frame->description.unreadable = NULL;
+  frame->rowCount = rowCount;
+
+  {
+    unsigned char *address = (unsigned char *)(frame + 1);
+
+    frame->characters = (ScreenCharacter *)address;
+    address += charactersSize;
+
+    if (numbersSize) frame->rowNumbers = (unsigned short *)address;
+  }
+
+  return frame;
+}
+
+static ScreenHistoryFrame *
+makeFrame (const ScreenDescription *description) {
+  int columns = description->cols;
+  int rows = description->rows;
+  const ScreenHistoryFrame *keyframe = currentKeyframe;
+
+  if (keyframe) {
+    if ((keyframe->description.cols != columns) || (keyframe->description.rows != rows)) {
+      keyframe = NULL;
+    } else if (deltasSinceKeyframe >= SCREEN_HISTORY_KEYFRAME_INTERVAL) {
+      keyframe = NULL;
+    }
+  }
+
+  if (keyframe) {
+    unsigned short changedRows[rows];
+    unsigned int changedCount = 0;
+
+    for (int row=0; row<rows; row+=1) {
+      if (!isSameRow(&keyframe->characters[row * columns], &newCharacters[row * columns], columns)) {
+        changedRows[changedCount++] = row;
+      }
+    }
+
+    if ((changedCount * 2) <= rows) {
+      ScreenHistoryFrame *frame = newFrame(description, changedCount, 0);
+
+      if (frame) {
+        frame->keyframe = keyframe;
+
+        for (unsigned int index=0; index<changedCount; index+=1) {
+          unsigned short row = changedRows[index];
+
+          frame->rowNumbers[index] = row;
+          memcpy(&frame->characters[index * columns], &newCharacters[row * columns],
+                 ARRAY_SIZE(frame->characters, columns));
+        }
+
+        deltasSinceKeyframe += 1;
+      }
+
+      return frame;
+    }
+  }
+
+  {
+    ScreenHistoryFrame *frame = newFrame(description, rows, 1);
+
+    if (frame) {
+      memcpy(frame->characters, newCharacters, ARRAY_SIZE(frame->characters, (rows * columns)));
+      currentKeyframe = frame;
+      deltasSinceKeyframe = 0;
+    }
+
+    return frame;
+  }
+}
+
+int
+addScreenHistory (BaseScreen *source) {
+  ScreenDescription description;
+  size_t count;
+  int top;
+
+  describeBaseScreen(source, &description);
+  if (description.unreadable) return 0;
+
+  /* only the visible screen is recorded - not any scrollback above it */
+  top = description.scrollback;
+  description.rows -= top;
+  description.posy -= top;
+  description.scrollback = 0;
+
+  count = description.cols * description.rows;
+  if (!prepareCharacterBuffers(count)) return 0;
+
+  {
+    const ScreenBox box = {
+      .left=0, .width=description.cols,
+      .top=top, .height=description.rows
+    };
+
+    if (!source->readCharacters(&box, newCharacters)) return 0;
+  }
+
+  if (haveLatest && historyCount && isSameDescription(&description, &latestDescription)) {
+    if (memcmp(newCharacters, latestCharacters, ARRAY_SIZE(newCharacters, count)) == 0) return 1;
+  }
+
+  {
+    /* make room for a keyframe so that the new image can always be added */
+    size_t limit = sizeof(ScreenHistoryFrame) + ARRAY_SIZE(newCharacters, count);
+
+    if (limit > SCREEN_HISTORY_MEMORY_LIMIT) return 0;
+    limit = SCREEN_HISTORY_MEMORY_LIMIT - limit;
+
+    while (historyCount &&
+           ((historyCount == SCREEN_HISTORY_FRAME_LIMIT) || (historySize > limit))) {
+      removeOldestGroup();
+    }
+  }
+
+  {
+    ScreenHistoryFrame *frame = makeFrame(&description);
+    if (!frame) return 0;
+
+    historyFrames[(historyStart + historyCount) % SCREEN_HISTORY_FRAME_LIMIT] = frame;
+    historyCount += 1;
+    historySize += frame->size;
+  }
+
+  {
+    ScreenCharacter *characters = latestCharacters;
+    latestCharacters = newCharacters;
+    newCharacters = characters;
+  }
+
+  latestDescription = description;
+  haveLatest = 1;
+  return 1;
+}
+
+int
+getScreenHistoryRange (unsigned long int *first, unsigned long int *last) {
+  if (!historyCount) return 0;
+
+  *first = historyFirst;
+  *last = historyFirst + historyCount - 1;
+  return 1;
+}
+
+int
+restoreScreenHistory (
+  unsigned long int sequence, ScreenDescription *description,
+  ScreenCharacter **characters, size_t *size
+) {
+  if (sequence < historyFirst) return 0;
+  if ((sequence -= historyFirst) >= historyCount) return 0;
+
+  {
+    const ScreenHistoryFrame *frame = getFrame(sequence);
+    const ScreenHistoryFrame *keyframe = frame->keyframe? frame->keyframe: frame;
+    int columns = frame->description.cols;
+    size_t count = columns * frame->description.rows;
+
+    if (count > *size) {
+      ScreenCharacter *buffer = malloc(ARRAY_SIZE(buffer, count));
+
+      if (!buffer) {
+        logMallocError();
+        return 0;
+      }
+
+      if (*characters) free(*characters);
+      *characters = buffer;
+      *size = count;
+    }
+
+    memcpy(*characters, keyframe->characters, ARRAY_SIZE(*characters, count));
+
+    if (frame->rowNumbers) {
+      for (unsigned int index=0; index<frame->rowCount; index+=1) {
+        memcpy(&(*characters)[frame->rowNumbers[index] * columns],
+               &frame->characters[index * columns],
+               ARRAY_SIZE(*characters, columns));
+      }
+    }
+
+    *description = frame->description;
+  }
+
+  return 1;
+}
@@ -0,0 +1,137 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "scr_index.h"
+#include "scr.h"
+#include "core.h"
+
+/* A summary of each row of the current screen. Rows are summarized on
+ * first use, and all of them are discarded whenever the screen is
+ * refreshed, so each row is read at most once per update cycle no matter
+ * how many navigation commands step over it.
+ */
+
+typedef struct {
+  ScreenRowSummary summary;
+  unsigned long int generation;
+} ScreenRowIndexEntry;
+
+static ScreenRowIndexEntry *indexEntries = NULL;
+static int indexSize = 0;
+static int indexColumns = 0;
+static unsigned long int indexGeneration = 1;
+
+void
+invalidateScreenRowIndex (void) {
+  indexGeneration += 1;
+}
+
+static int
+prepareScreenRowIndex (void) {
+  if (scr.cols != indexColumns) {
+    indexColumns = scr.cols;
+    invalidateScreenRowIndex();
+  }
+
+  if (scr.rows > indexSize) {
+    int size = scr.rows;
+    ScreenRowIndexEntry *entries = realloc(indexEntries, ARRAY_SIZE(entries, size));
+
+    if (!entries) {
+      logMallocError();
+      return 0;
+    }
+
+    for (int row=indexSize; row<size; row+=1) entries[row].generation = 0;
+    indexEntries = entries;
+    indexSize = size;
+  }
+
+  return 1;
+}
+
+static void
+summarizeScreenRow (ScreenRowSummary *summary, const ScreenCharacter *characters, int count) {
+  uint64_t textHash = UINT64_C(0XCBF29CE484222325);
+  uint64_t attributesHash = textHash;
+
+  summary->firstNonblank = -1;
+  summary->lastNonblank = -1;
+
+  for (int column=0; column<count; column+=1) {
+    const ScreenCharacter *character = &characters[column];
+
+    textHash ^= character->text;
+    textHash *= UINT64_C(0X100000001B3);
+
+    attributesHash ^= character->attributes;
+    attributesHash *= UINT64_C(0X100000001B3);
+
+    if (character->text != WC_C(' ')) {
+      if (summary->firstNonblank < 0) summary->firstNonblank = column;
+      summary->lastNonblank = column;
+    }
+  }
+
+  summary->textHash = textHash;
+  summary->attributesHash = attributesHash;
+}
+
+const ScreenRowSummary *
+getScreenRowSummary (int row) {
+  static const ScreenRowSummary blankSummary = {
+    .firstNonblank = -1,
+    .lastNonblank = -1
+  };
+
+  if (!SCR_ROW_OK(row)) return &blankSummary;
+  if (!prepareScreenRowIndex()) goto noIndex;
+
+  {
+    ScreenRowIndexEntry *entry = &indexEntries[row];
+
+    if (entry->generation != indexGeneration) {
+      ScreenCharacter characters[scr.cols];
+      if (!readScreenRow(row, scr.cols, characters)) return &blankSummary;
+
+      summarizeScreenRow(&entry->summary, characters, scr.cols);
+      entry->generation = indexGeneration;
+    }
+
+    return &entry->summary;
+  }
+
+noIndex:
+  {
+    ScreenCharacter characters[scr.cols];
+
+    if (readScreenRow(row, scr.cols, characters)) {
+      static ScreenRowSummary summary;
+
+      summarizeScreenRow(&summary, characters, scr.cols);
+      return &summary;
+    }
+  }
+
+  return &blankSummary;
+}
@@ -0,0 +1,47 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_SCR_INDEX
+#define BRLTTY_INCLUDED_SCR_INDEX
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+  uint64_t textHash;
+  uint64_t attributesHash;
+  int firstNonblank; /* -1 if the row is blank */
+  int lastNonblank;
+} ScreenRowSummary;
+
+extern void invalidateScreenRowIndex (void);
+extern const ScreenRowSummary *getScreenRowSummary (int row);
+
+static inline int
+isBlankScreenRange (const ScreenRowSummary *summary, int from, int to) {
+  return (summary->firstNonblank < 0)
+      || (summary->firstNonblank > to)
+      || (summary->lastNonblank < from);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_SCR_INDEX */
@@ -0,0 +1,287 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+#include <wctype.h>
+
+#include "log.h"
+#include "scr_search.h"
+#include "scr.h"
+#include "rgx.h"
+
+/* The whole screen is read once per search. A literal pattern is found
+ * with a Boyer-Moore-Horspool scan of that snapshot (in either direction),
+ * and a regular expression is matched one row at a time. A match never
+ * spans rows.
+ */
+
+#define SEARCH_SHIFT_TABLE_SIZE 0X100
+#define SEARCH_SHIFT_INDEX(character) ((character) & (SEARCH_SHIFT_TABLE_SIZE - 1))
+
+struct ScreenSearchStruct {
+  unsigned char ignoreCase;
+
+  wchar_t *pattern;
+  size_t length;
+
+  size_t forwardShifts[SEARCH_SHIFT_TABLE_SIZE];
+  size_t backwardShifts[SEARCH_SHIFT_TABLE_SIZE];
+
+  RGX_Object *expression;
+};
+
+static void
+prepareShiftTables (ScreenSearch *search) {
+  const wchar_t *pattern = search->pattern;
+  size_t length = search->length;
+
+  for (unsigned int index=0; index<SEARCH_SHIFT_TABLE_SIZE; index+=1) {
+    search->forwardShifts[index] = length;
+    search->backwardShifts[index] = length;
+  }
+
+  /* characters which share a table slot keep the smallest (safe) shift */
+  for (size_t index=0; index<length-1; index+=1) {
+    search->forwardShifts[SEARCH_SHIFT_INDEX(pattern[index])] = length - 1 - index;
+  }
+
+  for (size_t index=length-1; index>0; index-=1) {
+    search->backwardShifts[SEARCH_SHIFT_INDEX(pattern[index])] = index;
+  }
+}
+
+typedef struct {
+  size_t from;
+  size_t to;
+} ExpressionMatchData;
+
+static RGX_MATCH_HANDLER(handleExpressionMatch) {
+  ExpressionMatchData *emd = match->data.match;
+  return rgxGetCaptureBounds(match, 0, &emd->from, &emd->to);
+}
+
+ScreenSearch *
+newScreenSearch (
+  const wchar_t *characters, size_t count,
+  int ignoreCase, int regularExpression
+) {
+  ScreenSearch *search;
+
+  if (!count) return NULL;
+
+  if ((search = malloc(sizeof(*search)))) {
+    memset(search, 0, sizeof(*search));
+    search->ignoreCase = !!ignoreCase;
+    search->length = count;
+
+    if ((search->pattern = malloc(ARRAY_SIZE(search->pattern, count)))) {
+      for (size_t index=0; index<count; index+=1) {
+        wchar_t character = characters[index];
+        if (search->ignoreCase) character = towlower(character);
+        search->pattern[index] = character;
+      }
+
+      if (!regularExpression) {
+        prepareShiftTables(search);
+        return search;
+      }
+
+      if ((search->expression = rgxNewObject(search))) {
+        if (ignoreCase) rgxCompileOption(search->expression, RGX_OPTION_SET, RGX_COMPILE_IGNORE_CASE);
+
+        if (rgxAddPatternCharacters(search->expression, characters, count, handleExpressionMatch, NULL)) {
+          return search;
+        }
+
+        rgxDestroyObject(search->expression);
+      }
+
+      free(search->pattern);
+    } else {
+      logMallocError();
+    }
+
+    free(search);
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+void
+destroyScreenSearch (ScreenSearch *search) {
+  if (search->expression) rgxDestroyObject(search->expression);
+  free(search->pattern);
+  free(search);
+}
+
+static inline int
+isPatternAt (const ScreenSearch *search, const wchar_t *text) {
+  return wmemcmp(text, search->pattern, search->length) == 0;
+}
+
+static int
+findLiteralMatch (
+  const ScreenSearch *search, const wchar_t *text, size_t size,
+  int columns, size_t *offset, int backward
+) {
+  size_t length = search->length;
+  if (length > (size_t)columns) return 0;
+  if (length > size) return 0;
+
+  if (backward) {
+    /* the last match which starts before the offset */
+    size_t current = MIN(*offset, (size - length + 1));
+
+    while (current > 0) {
+      current -= 1;
+
+      if (isPatternAt(search, &text[current])) {
+        if ((current % columns) + length <= columns) {
+          *offset = current;
+          return 1;
+        }
+      }
+
+      {
+        size_t shift = search->backwardShifts[SEARCH_SHIFT_INDEX(text[current])] - 1;
+        if (shift >= current) break;
+        current -= shift;
+      }
+    }
+  } else {
+    /* the first match which starts at or after the offset */
+    size_t current = *offset;
+
+    while (current + length <= size) {
+      if (isPatternAt(search, &text[current])) {
+        if ((current % columns) + length <= columns) {
+          *offset = current;
+          return 1;
+        }
+      }
+
+      current += search->forwardShifts[SEARCH_SHIFT_INDEX(text[current + length - 1])];
+    }
+  }
+
+  return 0;
+}
+
+/* The whole row is given so that anchors, word boundaries, and look-behind
+ * assertions see what precedes the column.
+ */
+static int
+findExpressionMatch (ScreenSearch *search, const wchar_t *text, int columns, int *column) {
+  ExpressionMatchData emd;
+  RGX_Matcher *matcher = rgxMatchTextCharactersFrom(
+    search->expression, text, columns, *column, NULL, &emd
+  );
+
+  if (!matcher) return 0;
+  *column = emd.from;
+  return 1;
+}
+
+static int
+findRowExpressionMatch (
+  ScreenSearch *search, const wchar_t *text, int columns,
+  int *column, int backward
+) {
+  if (backward) {
+    /* the last match which starts before the column - each attempt resumes
+     * just after the previous match's start rather than rescanning the row
+     */
+    int limit = *column;
+    int found = -1;
+    int current = 0;
+
+    while ((current < limit) && findExpressionMatch(search, text, columns, &current)) {
+      if (current >= limit) break;
+      found = current++;
+    }
+
+    if (found < 0) return 0;
+    *column = found;
+  } else {
+    if (*column > columns) return 0;
+    if (!findExpressionMatch(search, text, columns, column)) return 0;
+  }
+
+  return 1;
+}
+
+int
+findScreenSearchMatch (
+  ScreenSearch *search, int columns, int rows,
+  int *column, int *row, int backward
+) {
+  int found = 0;
+  size_t size = columns * rows;
+  wchar_t *text;
+
+  if ((columns < 1) || (rows < 1)) return 0;
+  if ((*row < 0) || (*row >= rows)) return 0;
+
+  if (!(text = malloc(ARRAY_SIZE(text, size)))) {
+    logMallocError();
+    return 0;
+  }
+
+  if (readScreenText(0, 0, columns, rows, text)) {
+    if (search->expression) {
+      int currentRow = *row;
+      int currentColumn = MIN(MAX(*column, 0), columns);
+
+      while (1) {
+        if (findRowExpressionMatch(search, &text[currentRow * columns], columns, &currentColumn, backward)) {
+          *row = currentRow;
+          *column = currentColumn;
+          found = 1;
+          break;
+        }
+
+        if (backward) {
+          if (--currentRow < 0) break;
+          currentColumn = columns;
+        } else {
+          if (++currentRow == rows) break;
+          currentColumn = 0;
+        }
+      }
+    } else {
+      size_t offset = (*row * columns) + MIN(MAX(*column, 0), columns);
+
+      if (search->ignoreCase) {
+        for (size_t index=0; index<size; index+=1) text[index] = towlower(text[index]);
+      }
+
+      if (findLiteralMatch(search, text, size, columns, &offset, backward)) {
+        *row = offset / columns;
+        *column = offset % columns;
+        found = 1;
+      }
+    }
+  }
+
+  free(text);
+  return found;
+}
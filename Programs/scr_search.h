@@ -0,0 +1,44 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_SCR_SEARCH
+#define BRLTTY_INCLUDED_SCR_SEARCH
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct ScreenSearchStruct ScreenSearch;
+
+extern ScreenSearch *newScreenSearch (
+  const wchar_t *characters, size_t count,
+  int ignoreCase, int regularExpression
+);
+
+extern void destroyScreenSearch (ScreenSearch *search);
+
+extern int findScreenSearchMatch (
+  ScreenSearch *search, int columns, int rows,
+  int *column, int *row, int backward
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_SCR_SEARCH */
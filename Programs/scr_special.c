@@ -28,6 +28,7 @@
 #include "log.h"
 #include "scr.h"
 #include "scr_special.h"
+#include "scr_index.h"
 #include "update.h"
 #include "message.h"
 
@@ -163,6 +164,7 @@ setCurrentScreen (BaseScreen *screen) {
     currentScreen->onBackground();
     currentScreen = screen;
     currentScreen->onForeground();
+    invalidateScreenRowIndex();
 
     scheduleUpdate("new screen selected");
     announceCurrentScreen();
@@ -224,6 +226,11 @@ isSpecialScreen (SpecialScreenType type) {
   return currentScreen == getSpecialScreenEntry(type)->base;
 }
 
+int
+selectFrozenScreenImage (int offset) {
+  return frozenScreen.selectImage(offset);
+}
+
 int
 constructHelpScreen (void) {
   SpecialScreenEntry *sse = getSpecialScreenEntry(SCR_HELP);
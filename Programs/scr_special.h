@@ -39,6 +39,8 @@ extern void deactivateSpecialScreen (SpecialScreenType type);
 extern int haveSpecialScreen (SpecialScreenType type);
 extern int isSpecialScreen (SpecialScreenType type);
 
+extern int selectFrozenScreenImage (int offset);
+
 extern int constructHelpScreen (void);
 extern int addHelpPage (void);
 extern unsigned int getHelpPageCount (void);
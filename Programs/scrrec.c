@@ -0,0 +1,506 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* scrrec records what a screen driver presents so that it can be played
+ * back later by the Replay screen driver.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+
+#include "program.h"
+#include "options.h"
+#include "log.h"
+#include "parse.h"
+#include "timing.h"
+#include "bitfield.h"
+#include "async_wait.h"
+#include "async_signal.h"
+#include "scr.h"
+#include "scr_recording.h"
+#include "parameters.h"
+
+static char *opt_interval;
+static char *opt_duration;
+static char *opt_screenDriver;
+static char *opt_driversDirectory;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .letter = 'D',
+    .word = "drivers-directory",
+    .flags = OPT_Hidden,
+    .argument = "directory",
+    .setting.string = &opt_driversDirectory,
+    .internal.setting = DRIVERS_DIRECTORY,
+    .internal.adjust = fixInstallPath,
+    .description = "Path to directory for loading drivers."
+  },
+
+  { .letter = 'x',
+    .word = "screen-driver",
+    .argument = "driver",
+    .setting.string = &opt_screenDriver,
+    .internal.setting = DEFAULT_SCREEN_DRIVER,
+    .description = "Screen driver: one of {" SCREEN_DRIVER_CODES "}"
+  },
+
+  { .letter = 'i',
+    .word = "interval",
+    .argument = "milliseconds",
+    .setting.string = &opt_interval,
+    .internal.setting = STRINGIFY(SCREEN_UPDATE_POLL_INTERVAL),
+    .description = "How often to check the screen for changes."
+  },
+
+  { .letter = 'd',
+    .word = "duration",
+    .argument = "seconds",
+    .setting.string = &opt_duration,
+    .internal.setting = "0",
+    .description = "How long to record for (0 means until interrupted)."
+  },
+END_OPTION_TABLE
+
+/* unchanged characters shorter than this don't split a span */
+#define SPAN_MERGE_GAP 4
+
+static int stopRequested;
+static int screenUpdated;
+
+static FILE *recordingStream;
+static const char *recordingPath;
+static TimeValue recordingStart;
+static unsigned long int frameCount;
+
+static ScreenDescription previousDescription;
+static char *previousUnreadable = NULL;
+static ScreenCharacter *previousCharacters = NULL;
+static ScreenCharacter *currentCharacters = NULL;
+static size_t characterCount = 0;
+
+static unsigned char *spanBuffer = NULL;
+static size_t spanBufferSize = 0;
+static size_t spanBufferUsed;
+
+static int
+writeRecording (const void *data, size_t size) {
+  if (fwrite(data, 1, size, recordingStream) == size) return 1;
+  logMessage(LOG_ERR, "recording write error: %s: %s", recordingPath, strerror(errno));
+  return 0;
+}
+
+static void *
+reserveSpanBuffer (size_t size) {
+  size_t needed = spanBufferUsed + size;
+
+  if (needed > spanBufferSize) {
+    size_t newSize = MAX(needed, (spanBufferSize? spanBufferSize * 2: 0X1000));
+    unsigned char *newBuffer = realloc(spanBuffer, newSize);
+
+    if (!newBuffer) {
+      logMallocError();
+      return NULL;
+    }
+
+    spanBuffer = newBuffer;
+    spanBufferSize = newSize;
+  }
+
+  {
+    void *address = &spanBuffer[spanBufferUsed];
+    spanBufferUsed = needed;
+    return address;
+  }
+}
+
+static int
+addSpan (int row, int column, const ScreenCharacter *characters, int count) {
+  ScreenRecordingSpan *span = reserveSpanBuffer(sizeof(*span) + (count * sizeof(ScreenRecordingCharacter)));
+  if (!span) return 0;
+
+  putLittleEndian16(&span->row, row);
+  putLittleEndian16(&span->column, column);
+  putLittleEndian16(&span->count, count);
+
+  {
+    ScreenRecordingCharacter *character = (ScreenRecordingCharacter *)(span + 1);
+    const ScreenCharacter *end = characters + count;
+
+    while (characters < end) {
+      putLittleEndian32(&character->text, characters->text);
+      character->attributes = characters->attributes;
+
+      character += 1;
+      characters += 1;
+    }
+  }
+
+  return 1;
+}
+
+static int
+isSameCharacter (const ScreenCharacter *character1, const ScreenCharacter *character2) {
+  return (character1->text == character2->text)
+      && (character1->attributes == character2->attributes);
+}
+
+static int
+findSpans (int columns, int rows, unsigned int *count) {
+  *count = 0;
+
+  for (int row=0; row<rows; row+=1) {
+    const ScreenCharacter *old = &previousCharacters[row * columns];
+    const ScreenCharacter *new = &currentCharacters[row * columns];
+    int column = 0;
+
+    while (column < columns) {
+      if (isSameCharacter(&old[column], &new[column])) {
+        column += 1;
+        continue;
+      }
+
+      {
+        int start = column;
+        int end = column + 1;
+        int probe = end;
+
+        while (probe < columns) {
+          if (!isSameCharacter(&old[probe], &new[probe])) {
+            end = probe += 1;
+          } else if ((probe - end) < SPAN_MERGE_GAP) {
+            probe += 1;
+          } else {
+            break;
+          }
+        }
+
+        if (!addSpan(row, start, &new[start], end-start)) return 0;
+        *count += 1;
+        column = end;
+      }
+    }
+  }
+
+  return 1;
+}
+
+static int
+isSameDescription (const ScreenDescription *description1, const ScreenDescription *description2) {
+  if (description1->cols != description2->cols) return 0;
+  if (description1->rows != description2->rows) return 0;
+  if (description1->posx != description2->posx) return 0;
+  if (description1->posy != description2->posy) return 0;
+  if (description1->number != description2->number) return 0;
+  if (description1->quality != description2->quality) return 0;
+  if (description1->hasCursor != description2->hasCursor) return 0;
+  if (description1->hasSelection != description2->hasSelection) return 0;
+
+  if (!description1->unreadable != !description2->unreadable) return 0;
+  if (!description1->unreadable) return 1;
+  return strcmp(description1->unreadable, description2->unreadable) == 0;
+}
+
+static int
+recordFrame (void) {
+  ScreenDescription description;
+  unsigned int spanCount;
+  const char *unreadable;
+  size_t unreadableLength;
+
+  memset(&description, 0, sizeof(description));
+  describeScreen(&description);
+
+  {
+    size_t count = description.cols * description.rows;
+
+    if ((description.cols != previousDescription.cols) ||
+        (description.rows != previousDescription.rows)) {
+      if (count > characterCount) {
+        ScreenCharacter *previous;
+        ScreenCharacter *current;
+
+        if (!(previous = malloc(ARRAY_SIZE(previous, count)))) goto noMemory;
+
+        if (!(current = malloc(ARRAY_SIZE(current, count)))) {
+          free(previous);
+          goto noMemory;
+        }
+
+        if (previousCharacters) free(previousCharacters);
+        previousCharacters = previous;
+
+        if (currentCharacters) free(currentCharacters);
+        currentCharacters = current;
+
+        characterCount = count;
+      }
+
+      memset(previousCharacters, 0, ARRAY_SIZE(previousCharacters, count));
+    }
+
+    if (!readScreen(0, 0, description.cols, description.rows, currentCharacters)) {
+      logMessage(LOG_WARNING, "screen not readable");
+      return 1;
+    }
+  }
+
+  spanBufferUsed = 0;
+  if (!findSpans(description.cols, description.rows, &spanCount)) return 0;
+
+  if (!spanCount && frameCount && isSameDescription(&description, &previousDescription)) return 1;
+
+  if ((unreadable = description.unreadable)) {
+    unreadableLength = MIN(strlen(unreadable), UINT16_MAX);
+  } else {
+    unreadableLength = 0;
+  }
+
+  {
+    ScreenRecordingFrame frame;
+    uint8_t flags = 0;
+
+    if (description.hasCursor) flags |= SCREEN_RECORDING_FRAME_HAS_CURSOR;
+    if (description.hasSelection) flags |= SCREEN_RECORDING_FRAME_HAS_SELECTION;
+
+    putLittleEndian32(&frame.frameSize, (sizeof(frame) + unreadableLength + spanBufferUsed));
+    putLittleEndian32(&frame.time, getMonotonicElapsed(&recordingStart));
+
+    putLittleEndian16(&frame.columns, description.cols);
+    putLittleEndian16(&frame.rows, description.rows);
+    putLittleEndian16(&frame.cursorColumn, description.posx);
+    putLittleEndian16(&frame.cursorRow, description.posy);
+    putLittleEndian32(&frame.number, description.number);
+
+    frame.flags = flags;
+    frame.quality = description.quality;
+    putLittleEndian16(&frame.unreadableLength, unreadableLength);
+    putLittleEndian32(&frame.spanCount, spanCount);
+
+    if (!writeRecording(&frame, sizeof(frame))) return 0;
+    if (!writeRecording(unreadable, unreadableLength)) return 0;
+    if (!writeRecording(spanBuffer, spanBufferUsed)) return 0;
+  }
+
+  {
+    ScreenCharacter *characters = previousCharacters;
+    previousCharacters = currentCharacters;
+    currentCharacters = characters;
+  }
+
+  previousDescription = description;
+  previousDescription.unreadable = NULL;
+  frameCount += 1;
+
+  if (previousUnreadable) {
+    free(previousUnreadable);
+    previousUnreadable = NULL;
+  }
+
+  if (unreadable) {
+    /* keep a copy - the driver's string might not remain valid */
+    if ((previousUnreadable = strdup(unreadable))) {
+      previousDescription.unreadable = previousUnreadable;
+    }
+  }
+
+  return 1;
+
+noMemory:
+  logMallocError();
+  return 0;
+}
+
+static ASYNC_CONDITION_TESTER(testRecordingEvent) {
+  return stopRequested || screenUpdated;
+}
+
+#ifdef ASYNC_CAN_HANDLE_SIGNALS
+static ASYNC_SIGNAL_HANDLER(handleStopRequest) {
+  stopRequested = 1;
+}
+#endif /* ASYNC_CAN_HANDLE_SIGNALS */
+
+static int
+recordScreen (int interval, int duration) {
+  ScreenRecordingHeader header;
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SCREEN_RECORDING_MAGIC, sizeof(header.magic));
+  putLittleEndian16(&header.version, SCREEN_RECORDING_VERSION);
+  putLittleEndian16(&header.headerSize, sizeof(header));
+  if (!writeRecording(&header, sizeof(header))) return 0;
+
+  memset(&previousDescription, 0, sizeof(previousDescription));
+  frameCount = 0;
+  stopRequested = 0;
+
+#ifdef ASYNC_CAN_HANDLE_SIGNALS
+#ifdef SIGINT
+  asyncHandleSignal(SIGINT, handleStopRequest, NULL);
+#endif /* SIGINT */
+
+#ifdef SIGTERM
+  asyncHandleSignal(SIGTERM, handleStopRequest, NULL);
+#endif /* SIGTERM */
+#endif /* ASYNC_CAN_HANDLE_SIGNALS */
+
+  getMonotonicTime(&recordingStart);
+
+  while (1) {
+    screenUpdated = 0;
+    refreshScreen();
+    if (!recordFrame()) return 0;
+
+    if (duration && (getMonotonicElapsed(&recordingStart) >= duration)) break;
+    asyncAwaitCondition(interval, testRecordingEvent, NULL);
+    if (stopRequested) break;
+  }
+
+  logMessage(LOG_NOTICE, "frames recorded: %lu", frameCount);
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  ProgramExitStatus exitStatus;
+  void *driverObject;
+  int interval;
+  int duration;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "scrrec",
+      .argumentsSummary = "file [parameter=value ...]"
+    };
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  {
+    static const int minimum = 1;
+
+    if (!validateInteger(&interval, opt_interval, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid interval: %s", opt_interval);
+      return PROG_EXIT_SYNTAX;
+    }
+  }
+
+  {
+    static const int minimum = 0;
+
+    if (!validateInteger(&duration, opt_duration, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid duration: %s", opt_duration);
+      return PROG_EXIT_SYNTAX;
+    }
+
+    duration *= MSECS_PER_SEC;
+  }
+
+  if (!argc) {
+    logMessage(LOG_ERR, "missing recording file");
+    return PROG_EXIT_SYNTAX;
+  }
+
+  recordingPath = *argv++;
+  argc -= 1;
+
+  if ((screen = loadScreenDriver(opt_screenDriver, &driverObject, opt_driversDirectory))) {
+    const char *const *parameterNames = getScreenParameters(screen);
+    char **parameterSettings;
+
+    if (!parameterNames) {
+      static const char *const noNames[] = {NULL};
+      parameterNames = noNames;
+    }
+
+    {
+      const char *const *name = parameterNames;
+      unsigned int count;
+      char **setting;
+      while (*name) ++name;
+      count = name - parameterNames;
+      if (!(parameterSettings = malloc((count + 1) * sizeof(*parameterSettings)))) {
+        logMallocError();
+        return PROG_EXIT_FATAL;
+      }
+      setting = parameterSettings;
+      while (count--) *setting++ = "";
+      *setting = NULL;
+    }
+
+    while (argc) {
+      char *assignment = *argv++;
+      int ok = 0;
+      char *delimiter = strchr(assignment, '=');
+      if (!delimiter) {
+        logMessage(LOG_ERR, "missing screen parameter value: %s", assignment);
+      } else if (delimiter == assignment) {
+        logMessage(LOG_ERR, "missing screen parameter name: %s", assignment);
+      } else {
+        size_t nameLength = delimiter - assignment;
+        const char *const *name = parameterNames;
+        while (*name) {
+          if (strncasecmp(assignment, *name, nameLength) == 0) {
+            parameterSettings[name - parameterNames] = delimiter + 1;
+            ok = 1;
+            break;
+          }
+          ++name;
+        }
+        if (!ok) logMessage(LOG_ERR, "invalid screen parameter: %s", assignment);
+      }
+      if (!ok) return PROG_EXIT_SYNTAX;
+      --argc;
+    }
+
+    if (constructScreenDriver(parameterSettings)) {
+      if ((recordingStream = fopen(recordingPath, "wb"))) {
+        exitStatus = recordScreen(interval, duration)? PROG_EXIT_SUCCESS: PROG_EXIT_FATAL;
+
+        if (fclose(recordingStream) == EOF) {
+          logMessage(LOG_ERR, "recording close error: %s: %s", recordingPath, strerror(errno));
+          exitStatus = PROG_EXIT_FATAL;
+        }
+      } else {
+        logMessage(LOG_ERR, "cannot create recording: %s: %s", recordingPath, strerror(errno));
+        exitStatus = PROG_EXIT_FATAL;
+      }
+    } else {
+      logMessage(LOG_ERR, "can't open screen.");
+      exitStatus = PROG_EXIT_FATAL;
+    }
+
+    destructScreenDriver();
+  } else {
+    logMessage(LOG_ERR, "can't load screen driver.");
+    exitStatus = PROG_EXIT_FATAL;
+  }
+
+  return exitStatus;
+}
+
+#include "update.h"
+
+void
+scheduleUpdateIn (const char *reason, int delay) {
+  screenUpdated = 1;
+}
@@ -27,12 +27,14 @@
 #include "options.h"
 #include "log.h"
 #include "parse.h"
+#include "timing.h"
 #include "scr.h"
 
 static char *opt_boxLeft;
 static char *opt_boxWidth;
 static char *opt_boxTop;
 static char *opt_boxHeight;
+static char *opt_iterations;
 static char *opt_screenDriver;
 static char *opt_driversDirectory;
 
@@ -82,8 +84,41 @@ BEGIN_OPTION_TABLE(programOptions)
     .setting.string = &opt_boxHeight,
     .description = "Height of region."
   },
+
+  { .letter = 'i',
+    .word = "iterations",
+    .argument = "count",
+    .setting.string = &opt_iterations,
+    .description = "Measure the time taken to refresh and read the region this many times."
+  },
 END_OPTION_TABLE
 
+static void
+measureReads (int iterations, int left, int top, int width, int height) {
+  ScreenCharacter buffer[width * height];
+  TimeValue start, end;
+  double nanoseconds;
+
+  getMonotonicTime(&start);
+
+  for (int iteration=0; iteration<iterations; iteration+=1) {
+    refreshScreen();
+
+    if (!readScreen(left, top, width, height, buffer)) {
+      logMessage(LOG_ERR, "Can't read screen.");
+      return;
+    }
+  }
+
+  getMonotonicTime(&end);
+  nanoseconds = ((double)(end.seconds - start.seconds) * NSECS_PER_SEC)
+              + (end.nanoseconds - start.nanoseconds);
+
+  printf("Reads: %d, %.1f ns/read, %.1f ns/character\n",
+         iterations, (nanoseconds / iterations),
+         (nanoseconds / ((double)iterations * width * height)));
+}
+
 static int
 setRegion (
   int *offsetValue, const char *offsetOption, const char *offsetName,
@@ -138,6 +173,17 @@ main (int argc, char *argv[]) {
     PROCESS_OPTIONS(descriptor, argc, argv);
   }
 
+  int iterations = 0;
+
+  if (*opt_iterations) {
+    static const int minimum = 1;
+
+    if (!validateInteger(&iterations, opt_iterations, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid iteration count: %s", opt_iterations);
+      return PROG_EXIT_SYNTAX;
+    }
+  }
+
   if ((screen = loadScreenDriver(opt_screenDriver, &driverObject, opt_driversDirectory))) {
     const char *const *parameterNames = getScreenParameters(screen);
     char **parameterSettings;
@@ -220,6 +266,8 @@ main (int argc, char *argv[]) {
                 }
                 putchar('\n');
               }
+
+              if (iterations) measureReads(iterations, left, top, width, height);
               exitStatus = PROG_EXIT_SUCCESS;
             } else {
               logMessage(LOG_ERR, "Can't read screen.");
@@ -31,6 +31,7 @@
 #include "async_event.h"
 #include "thread.h"
 #include "queue.h"
+#include "timing.h"
 
 #ifdef ENABLE_SPEECH_SUPPORT
 typedef enum {
@@ -78,10 +79,25 @@ typedef enum {
   RSP_INTEGER
 } SpeechResponseType;
 
+typedef struct {
+  size_t offset;
+  unsigned int muteGeneration;
+  unsigned char isFinal:1;
+} SpeechChunk;
+
 struct SpeechDriverThreadStruct {
   ThreadState threadState;
   Queue *requestQueue;
 
+  struct {
+    SpeechChunk array[SPEECH_CHUNK_QUEUE_SIZE];
+    unsigned int start;
+    unsigned int count;
+  } chunks;
+
+  unsigned int muteGeneration;
+  unsigned int sayGeneration; /* of the text the driver was last given */
+
   volatile SpeechSynthesizer *speechSynthesizer;
   char **driverParameters;
 
@@ -133,8 +149,13 @@ typedef struct {
       size_t count;
       const unsigned char *attributes;
       SayOptions options;
+      unsigned int muteGeneration;
     } sayText;
 
+    struct {
+      TimeValue time;
+    } muteSpeech;
+
     struct {
       unsigned char setting;
     } setVolume;
@@ -178,6 +199,7 @@ static const char *const speechMessageNames[] = {
 
 typedef struct {
   SpeechMessageType type;
+  unsigned int muteGeneration;
 
   union {
     struct {
@@ -329,6 +351,80 @@ awaitSpeechResponse (volatile SpeechDriverThread *sdt, int timeout) {
 
 static void sendSpeechRequest (volatile SpeechDriverThread *sdt);
 
+static inline unsigned int
+getMuteGeneration (volatile SpeechDriverThread *sdt) {
+  return __atomic_load_n(&sdt->muteGeneration, __ATOMIC_ACQUIRE);
+}
+
+/* Long text is said as a sequence of chunks, and the driver reports the
+ * location and completion of each chunk separately. The chunks which haven't
+ * finished yet are remembered, oldest first, so that those reports can be
+ * made relative to the whole text. Chunks and reports carry the mute
+ * generation of their text, so that a late report about muted text doesn't
+ * finish, or offset the location within, the text which followed it.
+ */
+
+static void
+clearSpeechChunks (volatile SpeechDriverThread *sdt) {
+  sdt->chunks.start = 0;
+  sdt->chunks.count = 0;
+}
+
+static void
+addSpeechChunk (volatile SpeechDriverThread *sdt, size_t offset, int isFinal, unsigned int muteGeneration) {
+  if (sdt->chunks.count == SPEECH_CHUNK_QUEUE_SIZE) {
+    /* some drivers never report completion */
+    sdt->chunks.start = (sdt->chunks.start + 1) % SPEECH_CHUNK_QUEUE_SIZE;
+    sdt->chunks.count -= 1;
+  }
+
+  {
+    volatile SpeechChunk *chunk = &sdt->chunks.array[
+      (sdt->chunks.start + sdt->chunks.count) % SPEECH_CHUNK_QUEUE_SIZE
+    ];
+
+    chunk->offset = offset;
+    chunk->muteGeneration = muteGeneration;
+    chunk->isFinal = isFinal;
+  }
+
+  sdt->chunks.count += 1;
+}
+
+static volatile SpeechChunk *
+getSpeechChunk (volatile SpeechDriverThread *sdt, unsigned int muteGeneration) {
+  if (!sdt->chunks.count) return NULL;
+
+  {
+    volatile SpeechChunk *chunk = &sdt->chunks.array[sdt->chunks.start];
+
+    if (chunk->muteGeneration != muteGeneration) return NULL;
+    return chunk;
+  }
+}
+
+static size_t
+getSpeechChunkOffset (volatile SpeechDriverThread *sdt, unsigned int muteGeneration) {
+  volatile SpeechChunk *chunk = getSpeechChunk(sdt, muteGeneration);
+
+  return chunk? chunk->offset: 0;
+}
+
+static int
+finishSpeechChunk (volatile SpeechDriverThread *sdt, unsigned int muteGeneration) {
+  volatile SpeechChunk *chunk = getSpeechChunk(sdt, muteGeneration);
+
+  if (!chunk) return 1;
+
+  {
+    int isFinal = chunk->isFinal;
+
+    sdt->chunks.start = (sdt->chunks.start + 1) % SPEECH_CHUNK_QUEUE_SIZE;
+    sdt->chunks.count -= 1;
+    return isFinal;
+  }
+}
+
 static void
 handleSpeechMessage (volatile SpeechDriverThread *sdt, SpeechMessage *msg) {
   logSpeechMessage(msg, "handling");
@@ -344,6 +440,12 @@ handleSpeechMessage (volatile SpeechDriverThread *sdt, SpeechMessage *msg) {
         volatile SpeechSynthesizer *spk = sdt->speechSynthesizer;
         SetSpeechFinishedMethod *setFinished = spk->setFinished;
 
+        if (msg->muteGeneration != sdt->muteGeneration) {
+          logMessage(LOG_CATEGORY(SPEECH_EVENTS), "ignoring stale speech message");
+          break;
+        }
+
+        if (!finishSpeechChunk(sdt, msg->muteGeneration)) break;
         if (setFinished) setFinished(spk);
         break;
       }
@@ -352,7 +454,16 @@ handleSpeechMessage (volatile SpeechDriverThread *sdt, SpeechMessage *msg) {
         volatile SpeechSynthesizer *spk = sdt->speechSynthesizer;
         SetSpeechLocationMethod *setLocation = spk->setLocation;
 
-        if (setLocation) setLocation(spk, msg->arguments.speechLocation.location);
+        if (msg->muteGeneration != sdt->muteGeneration) {
+          logMessage(LOG_CATEGORY(SPEECH_EVENTS), "ignoring stale speech message");
+          break;
+        }
+
+        if (setLocation) {
+          int location = msg->arguments.speechLocation.location;
+
+          setLocation(spk, location + getSpeechChunkOffset(sdt, msg->muteGeneration));
+        }
         break;
       }
 
@@ -418,6 +529,7 @@ speechMessage_speechFinished (
   SpeechMessage *msg;
 
   if ((msg = newSpeechMessage(MSG_SPEECH_FINISHED, NULL))) {
+    msg->muteGeneration = sdt->sayGeneration;
     if (sendSpeechMessage(sdt, msg)) return 1;
 
     free(msg);
@@ -434,6 +546,7 @@ speechMessage_speechLocation (
   SpeechMessage *msg;
 
   if ((msg = newSpeechMessage(MSG_SPEECH_LOCATION, NULL))) {
+    msg->muteGeneration = sdt->sayGeneration;
     msg->arguments.speechLocation.location = location;
     if (sendSpeechMessage(sdt, msg)) return 1;
 
@@ -461,7 +574,14 @@ handleSpeechRequest (volatile SpeechDriverThread *sdt, SpeechRequest *req) {
         int restorePitch = 0;
         int restorePunctuation = 0;
 
+        if (req->arguments.sayText.muteGeneration != getMuteGeneration(sdt)) {
+          /* muted after it was sent to this thread */
+          sendIntegerResponse(sdt, 1);
+          break;
+        }
+
         if (options & SAY_OPT_MUTE_FIRST) speech->mute(spk);
+        sdt->sayGeneration = req->arguments.sayText.muteGeneration;
 
         if (options & SAY_OPT_HIGHER_PITCH) {
           if (spk->setPitch) {
@@ -502,6 +622,10 @@ handleSpeechRequest (volatile SpeechDriverThread *sdt, SpeechRequest *req) {
       case REQ_MUTE_SPEECH: {
         speech->mute(spk);
 
+        logMessage(LOG_CATEGORY(SPEECH_EVENTS),
+                   "mute latency: %ldms",
+                   getMonotonicElapsed(&req->arguments.muteSpeech.time));
+
         sendIntegerResponse(sdt, 1);
         break;
       }
@@ -587,6 +711,10 @@ static void
 muteSpeechRequestQueue (volatile SpeechDriverThread *sdt) {
   removeSpeechRequests(sdt, REQ_SAY_TEXT);
   removeSpeechRequests(sdt, REQ_MUTE_SPEECH);
+  clearSpeechChunks(sdt);
+
+  /* published to the driver thread, which drops say requests from before it */
+  __atomic_add_fetch(&sdt->muteGeneration, 1, __ATOMIC_RELEASE);
 }
 
 static void
@@ -647,8 +775,8 @@ newSpeechRequest (SpeechRequestType type, SpeechDatum *data) {
   return NULL;
 }
 
-int
-speechRequest_sayText (
+static int
+enqueueSayTextRequest (
   volatile SpeechDriverThread *sdt,
   const char *text, size_t length,
   size_t count, const unsigned char *attributes,
@@ -662,21 +790,132 @@ speechRequest_sayText (
   END_SPEECH_DATA
 
   if ((req = newSpeechRequest(REQ_SAY_TEXT, data))) {
-    req->arguments.sayText.text = data[0].address;
+    unsigned char *buffer = (unsigned char *)data[0].address;
+
+    buffer[length] = 0;
+    req->arguments.sayText.text = buffer;
     req->arguments.sayText.length = length;
     req->arguments.sayText.count = count;
     req->arguments.sayText.attributes = data[1].address;
     req->arguments.sayText.options = options;
+    req->arguments.sayText.muteGeneration = sdt->muteGeneration;
 
-    if (options & SAY_OPT_MUTE_FIRST) muteSpeechRequestQueue(sdt);
     if (enqueueSpeechRequest(sdt, req)) return 1;
-
     free(req);
   }
 
   return 0;
 }
 
+static size_t
+findSpeechChunkEnd (const unsigned char *text, const size_t *offsets, size_t from, size_t count, size_t limit) {
+  if ((count - from) <= limit) return count;
+
+  {
+    size_t sentence = 0;
+    size_t clause = 0;
+    size_t word = 0;
+    size_t index = from + limit;
+    size_t minimum = from + (limit / 2);
+
+    while (--index > minimum) {
+      if (text[offsets[index]] == ' ') {
+        unsigned char before = text[offsets[index-1]];
+
+        if ((before == '.') || (before == '!') || (before == '?')) {
+          sentence = index + 1;
+          break;
+        }
+
+        if (!clause && ((before == ',') || (before == ';') || (before == ':'))) {
+          clause = index + 1;
+        }
+
+        if (!word) word = index + 1;
+      }
+    }
+
+    if (sentence) return sentence;
+    if (clause) return clause;
+    if (word) return word;
+    return from + limit;
+  }
+}
+
+static int
+getCharacterOffsets (const unsigned char *text, size_t length, size_t *offsets, size_t count) {
+  size_t index = 0;
+
+  for (size_t byte=0; byte<length; byte+=1) {
+    if ((text[byte] & 0XC0) != 0X80) {
+      if (index == count) return 0;
+      offsets[index++] = byte;
+    }
+  }
+
+  if (index != count) return 0;
+  offsets[count] = length;
+  return 1;
+}
+
+static int
+sayTextInChunks (
+  volatile SpeechDriverThread *sdt,
+  const char *text, const size_t *offsets,
+  size_t count, const unsigned char *attributes,
+  SayOptions options
+) {
+  size_t from = 0;
+  size_t limit = SPEECH_CHUNK_FIRST_LIMIT;
+
+  while (from < count) {
+    size_t to = findSpeechChunkEnd((const unsigned char *)text, offsets, from, count, limit);
+
+    addSpeechChunk(sdt, from, (to == count), sdt->muteGeneration);
+
+    if (!enqueueSayTextRequest(sdt,
+                               &text[offsets[from]], offsets[to] - offsets[from],
+                               to - from, attributes? &attributes[from]: NULL,
+                               options)) {
+      return 0;
+    }
+
+    options &= ~SAY_OPT_MUTE_FIRST;
+    limit = SPEECH_CHUNK_LIMIT;
+    from = to;
+  }
+
+  return 1;
+}
+
+int
+speechRequest_sayText (
+  volatile SpeechDriverThread *sdt,
+  const char *text, size_t length,
+  size_t count, const unsigned char *attributes,
+  SayOptions options
+) {
+  if (options & SAY_OPT_MUTE_FIRST) muteSpeechRequestQueue(sdt);
+
+  if (count > SPEECH_CHUNK_THRESHOLD) {
+    size_t *offsets;
+
+    if ((offsets = malloc(ARRAY_SIZE(offsets, count+1)))) {
+      int said = 0;
+      int ok = getCharacterOffsets((const unsigned char *)text, length, offsets, count);
+
+      if (ok) said = sayTextInChunks(sdt, text, offsets, count, attributes, options);
+      free(offsets);
+      if (ok) return said;
+    } else {
+      logMallocError();
+    }
+  }
+
+  addSpeechChunk(sdt, 0, 1, sdt->muteGeneration);
+  return enqueueSayTextRequest(sdt, text, length, count, attributes, options);
+}
+
 int
 speechRequest_muteSpeech (
   volatile SpeechDriverThread *sdt
@@ -684,6 +923,7 @@ speechRequest_muteSpeech (
   SpeechRequest *req;
 
   if ((req = newSpeechRequest(REQ_MUTE_SPEECH, NULL))) {
+    getMonotonicTime(&req->arguments.muteSpeech.time);
     muteSpeechRequestQueue(sdt);
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
@@ -864,6 +1104,16 @@ deallocateSpeechRequest (void *item, void *data) {
   free(req);
 }
 
+static int
+compareSpeechRequests (const void *newItem, const void *existingItem, void *queueData) {
+  const SpeechRequest *newRequest = newItem;
+  const SpeechRequest *existingRequest = existingItem;
+
+  /* a mute only goes ahead of text - settings keep their order */
+  if (newRequest->type != REQ_MUTE_SPEECH) return 0;
+  return existingRequest->type == REQ_SAY_TEXT;
+}
+
 int
 constructSpeechDriverThread (
   volatile SpeechSynthesizer *spk,
@@ -879,7 +1129,7 @@ constructSpeechDriverThread (
     sdt->speechSynthesizer = spk;
     sdt->driverParameters = parameters;
 
-    if ((sdt->requestQueue = newQueue(deallocateSpeechRequest, NULL))) {
+    if ((sdt->requestQueue = newQueue(deallocateSpeechRequest, compareSpeechRequests))) {
       spk->driver.thread = sdt;
 
 #ifdef GOT_PTHREADS
@@ -33,11 +33,14 @@
 #include "file.h"
 #include "parse.h"
 #include "async_wait.h"
+#include "timing.h"
 
 static char *opt_textString;
 static char *opt_speechVolume;
 static char *opt_speechRate;
 static char *opt_pcmDevice;
+static char *opt_muteDelay;
+static int opt_latency;
 static char *opt_driversDirectory;
 
 BEGIN_OPTION_TABLE(programOptions)
@@ -78,11 +81,85 @@ BEGIN_OPTION_TABLE(programOptions)
     .setting.string = &opt_pcmDevice,
     .description = "Digital audio soundcard device specifier."
   },
+
+  { .letter = 'm',
+    .word = "mute-delay",
+    .argument = "milliseconds",
+    .setting.string = &opt_muteDelay,
+    .description = "Mute each text after this long."
+  },
+
+  { .letter = 'l',
+    .word = "latency",
+    .setting.flag = &opt_latency,
+    .description = "Report how long each text takes to start being spoken."
+  },
 END_OPTION_TABLE
 
+static int muteDelay = 0;
+
+#define LATENCY_TIMEOUT 10000
+
+static TimeValue sayTime;
+static int awaitingSpeech = 0;
+static int speechActive = 0;
+
+static void
+reportLatency (void) {
+  if (awaitingSpeech) {
+    awaitingSpeech = 0;
+    logMessage(LOG_NOTICE, "speech started after %ld ms", getMonotonicElapsed(&sayTime));
+  }
+}
+
+ASYNC_CONDITION_TESTER(testSpeechStarted) {
+  return !awaitingSpeech;
+}
+
+ASYNC_CONDITION_TESTER(testSpeechFinished) {
+  return !speechActive;
+}
+
+static void
+reportSpeechFinished (volatile SpeechSynthesizer *spk) {
+  reportLatency();
+  speechActive = 0;
+  if (muteDelay) logMessage(LOG_NOTICE, "speech finished");
+}
+
+static void
+reportSpeechLocation (volatile SpeechSynthesizer *spk, int location) {
+  reportLatency();
+  if (muteDelay) logMessage(LOG_NOTICE, "speech location: %d", location);
+}
+
 static int
 say (volatile SpeechSynthesizer *spk, const char *string) {
+  if (opt_latency) {
+    /* so that a late report about the previous text isn't mistaken */
+    asyncAwaitCondition(LATENCY_TIMEOUT, testSpeechFinished, NULL);
+
+    getMonotonicTime(&sayTime);
+    awaitingSpeech = 1;
+    speechActive = 1;
+  }
+
   if (!sayString(spk, string, 0)) return 0;
+
+  if (opt_latency) {
+    if (!asyncAwaitCondition(LATENCY_TIMEOUT, testSpeechStarted, NULL)) {
+      awaitingSpeech = 0;
+      speechActive = 0;
+      logMessage(LOG_WARNING, "speech not started within %d ms", LATENCY_TIMEOUT);
+    }
+  }
+
+  if (muteDelay) {
+    asyncWait(muteDelay);
+    muteSpeech(spk, "test");
+    speechActive = 0;
+  }
+
   asyncWait(250);
   return 1;
 }
@@ -137,6 +214,15 @@ main (int argc, char *argv[]) {
     }
   }
 
+  if (opt_muteDelay && *opt_muteDelay) {
+    static const int minimum = 1;
+
+    if (!validateInteger(&muteDelay, opt_muteDelay, &minimum, NULL)) {
+      logMessage(LOG_ERR, "%s: %s", "invalid mute delay", opt_muteDelay);
+      return PROG_EXIT_SYNTAX;
+    }
+  }
+
   if (argc) {
     driver = *argv++, --argc;
   }
@@ -202,6 +288,15 @@ main (int argc, char *argv[]) {
     constructSpeechSynthesizer(&spk);
     identifySpeechDriver(speech, 0);		/* start-up messages */
 
+    if (muteDelay || opt_latency) {
+      /* Reports about muted text are logged, and the first report about
+       * each text is taken to be when it started being spoken.
+       */
+      spk.setFinished = reportSpeechFinished;
+      spk.setLocation = reportSpeechLocation;
+      spk.track.isActive = 1;
+    }
+
     if (startSpeechDriverThread(&spk, parameterSettings)) {
       setSpeechVolume(&spk, speechVolume, 0);
       setSpeechRate(&spk, speechRate, 0);
@@ -24,6 +24,7 @@
 #include "log.h"
 #include "strfmt.h"
 #include "thread.h"
+#include "lock_profile.h"
 #include "async_signal.h"
 #include "async_event.h"
 #include "async_wait.h"
@@ -207,7 +208,22 @@ callThreadFunction (
 
 int
 lockMutex (pthread_mutex_t *mutex) {
-  int result = pthread_mutex_lock(mutex);
+  int result;
+
+  if (isLockProfilingEnabled()) {
+    TimeValue waitStart;
+    int contended = 0;
+
+    if ((result = pthread_mutex_trylock(mutex)) == EBUSY) {
+      getMonotonicTime(&waitStart);
+      result = pthread_mutex_lock(mutex);
+      contended = 1;
+    }
+
+    if (!result) recordLockAcquisition(mutex, NULL, (contended? &waitStart: NULL), 1);
+  } else {
+    result = pthread_mutex_lock(mutex);
+  }
 
   logSymbol(LOG_CATEGORY(ASYNC_EVENTS), mutex, "mutex lock");
   return result;
@@ -216,6 +232,7 @@ lockMutex (pthread_mutex_t *mutex) {
 int
 unlockMutex (pthread_mutex_t *mutex) {
   logSymbol(LOG_CATEGORY(ASYNC_EVENTS), mutex, "mutex unlock");
+  if (isLockProfilingEnabled()) recordLockRelease(mutex);
   return pthread_mutex_unlock(mutex);
 }
 
@@ -0,0 +1,284 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2020 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "log.h"
+#include "trace.h"
+#include "timing.h"
+#include "thread.h"
+
+/* Each thread appends records to its own buffer without locking, and then
+ * publishes the new count. Only the owning thread changes the count, and it
+ * only resets it (after appending a full buffer to the trace file) while
+ * holding traceLock. When the trace is stopped, each buffer's records from
+ * the last written one up to its published count are written, so a thread
+ * which is in the middle of an append isn't disturbed. Buffers are never
+ * freed since a thread keeps its buffer across traces, and since a thread
+ * which has finished may still have records which haven't been written.
+ */
+
+#define TRACE_BUFFER_SIZE 0X800
+
+typedef struct TraceBufferStruct TraceBuffer;
+
+struct TraceBufferStruct {
+  TraceBuffer *next;
+  unsigned int count;
+  unsigned int written;
+  uint16_t thread;
+  char name[sizeof(((TraceRecord *)NULL)->arguments) + 1];
+  TraceRecord records[TRACE_BUFFER_SIZE];
+};
+
+unsigned char traceEnabled = 0;
+
+static CriticalSectionLock traceLock = CRITICAL_SECTION_LOCK_INITIALIZER;
+static FILE *traceFile = NULL;
+static TraceBuffer *traceBuffers = NULL;
+static uint16_t traceThreadCount = 0;
+static unsigned long int traceFailures = 0;
+
+#ifdef THREAD_LOCAL
+static THREAD_LOCAL TraceBuffer *currentTraceBuffer = NULL;
+#define publishTraceCount(buffer, value) __atomic_store_n(&(buffer)->count, (value), __ATOMIC_RELEASE)
+#define getPublishedTraceCount(buffer) __atomic_load_n(&(buffer)->count, __ATOMIC_ACQUIRE)
+#define beginTraceRecord()
+#define endTraceRecord()
+#define lockTraceBuffers() enterCriticalSection(&traceLock)
+#define unlockTraceBuffers() leaveCriticalSection(&traceLock)
+#else /* THREAD_LOCAL */
+/* all of the threads share one buffer */
+static TraceBuffer *currentTraceBuffer = NULL;
+#define publishTraceCount(buffer, value) ((buffer)->count = (value))
+#define getPublishedTraceCount(buffer) ((buffer)->count)
+#define beginTraceRecord() enterCriticalSection(&traceLock)
+#define endTraceRecord() leaveCriticalSection(&traceLock)
+#define lockTraceBuffers()
+#define unlockTraceBuffers()
+#endif /* THREAD_LOCAL */
+
+static uint64_t
+getTraceTime (void) {
+  TimeValue now;
+
+  getMonotonicTime(&now);
+  return ((uint64_t)now.seconds * NSECS_PER_SEC) + now.nanoseconds;
+}
+
+/* The caller must hold traceLock. */
+static void
+writeTraceBuffer (TraceBuffer *buffer, unsigned int count) {
+  if (count > buffer->written) {
+    if (traceFile) {
+      unsigned int length = count - buffer->written;
+
+      if (fwrite(&buffer->records[buffer->written], sizeof(buffer->records[0]), length, traceFile) != length) {
+        traceFailures += 1;
+      }
+
+      fflush(traceFile);
+    }
+
+    buffer->written = count;
+  }
+}
+
+static void
+setThreadNameRecord (TraceRecord *record, const TraceBuffer *buffer) {
+  memset(record, 0, sizeof(*record));
+  record->time = getTraceTime();
+  record->event = TRACE_EVT_THREAD_NAME;
+  record->thread = buffer->thread;
+  memcpy(record->arguments, buffer->name, strlen(buffer->name));
+}
+
+/* The caller must hold traceLock. */
+static TraceBuffer *
+newTraceBuffer (void) {
+  TraceBuffer *buffer;
+
+  if (!(buffer = malloc(sizeof(*buffer)))) return NULL;
+  buffer->count = 0;
+  buffer->written = 0;
+  buffer->thread = traceThreadCount++;
+
+  if (!formatThreadName(buffer->name, sizeof(buffer->name))) {
+    snprintf(buffer->name, sizeof(buffer->name), "%u", buffer->thread);
+  }
+
+  buffer->next = traceBuffers;
+  traceBuffers = buffer;
+
+  setThreadNameRecord(&buffer->records[0], buffer);
+  publishTraceCount(buffer, 1);
+  return buffer;
+}
+
+static TraceRecord *
+getTraceRecord (TraceEvent event) {
+  TraceBuffer *buffer = currentTraceBuffer;
+
+  if (!buffer) {
+    lockTraceBuffers();
+      buffer = newTraceBuffer();
+    unlockTraceBuffers();
+
+    if (!buffer) return NULL;
+    currentTraceBuffer = buffer;
+  }
+
+  if (buffer->count == TRACE_BUFFER_SIZE) {
+    lockTraceBuffers();
+      writeTraceBuffer(buffer, buffer->count);
+      buffer->written = 0;
+      publishTraceCount(buffer, 0);
+    unlockTraceBuffers();
+  }
+
+  {
+    TraceRecord *record = &buffer->records[buffer->count];
+
+    record->time = getTraceTime();
+    record->event = event;
+    record->thread = buffer->thread;
+    return record;
+  }
+}
+
+static void
+endTraceAppend (void) {
+  TraceBuffer *buffer = currentTraceBuffer;
+  publishTraceCount(buffer, buffer->count+1);
+}
+
+void
+recordTraceEvent (TraceEvent event, const uint32_t *arguments) {
+  beginTraceRecord();
+
+  {
+    TraceRecord *record = getTraceRecord(event);
+
+    if (record) {
+      memcpy(record->arguments, arguments, sizeof(record->arguments));
+      endTraceAppend();
+    }
+  }
+
+  endTraceRecord();
+}
+
+void
+recordTraceBytes (TraceEvent event, const void *bytes, size_t count) {
+  beginTraceRecord();
+
+  {
+    TraceRecord *record = getTraceRecord(event);
+
+    if (record) {
+      size_t size = sizeof(record->arguments) - sizeof(record->arguments[0]);
+
+      memset(record->arguments, 0, sizeof(record->arguments));
+      record->arguments[0] = count;
+      memcpy(&record->arguments[1], bytes, MIN(count, size));
+      endTraceAppend();
+    }
+  }
+
+  endTraceRecord();
+}
+
+int
+startTrace (const char *path) {
+  stopTrace();
+
+  if ((traceFile = fopen(path, "wb"))) {
+    TraceFileHeader header;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_FILE_VERSION;
+    header.recordSize = sizeof(TraceRecord);
+    header.eventCount = TRACE_EVENT_COUNT;
+
+    {
+      TimeValue now;
+
+      getCurrentTime(&now);
+      header.realTimeOffset = (((int64_t)now.seconds * NSECS_PER_SEC) + now.nanoseconds)
+                            - (int64_t)getTraceTime();
+    }
+
+    if (fwrite(&header, sizeof(header), 1, traceFile) == 1) {
+      /* threads which have already traced keep their buffers (and names) */
+      enterCriticalSection(&traceLock);
+      {
+        TraceBuffer *buffer = traceBuffers;
+
+        while (buffer) {
+          TraceRecord record;
+
+          /* discard anything appended after the previous trace was stopped */
+          buffer->written = getPublishedTraceCount(buffer);
+
+          setThreadNameRecord(&record, buffer);
+          fwrite(&record, sizeof(record), 1, traceFile);
+          buffer = buffer->next;
+        }
+      }
+      leaveCriticalSection(&traceLock);
+      fflush(traceFile);
+
+      traceFailures = 0;
+      __atomic_store_n(&traceEnabled, 1, __ATOMIC_RELEASE);
+      logMessage(LOG_DEBUG, "trace started: %s", path);
+      return 1;
+    }
+
+    logSystemError("trace header write");
+    fclose(traceFile);
+    traceFile = NULL;
+  } else {
+    logMessage(LOG_WARNING, "trace file open error: %s: %s", path, strerror(errno));
+  }
+
+  return 0;
+}
+
+void
+stopTrace (void) {
+  __atomic_store_n(&traceEnabled, 0, __ATOMIC_RELEASE);
+
+  enterCriticalSection(&traceLock);
+  {
+    for (TraceBuffer *buffer=traceBuffers; buffer; buffer=buffer->next) {
+      writeTraceBuffer(buffer, getPublishedTraceCount(buffer));
+    }
+
+    if (traceFile) {
+      if (traceFailures) logMessage(LOG_WARNING, "trace buffers not written: %lu", traceFailures);
+      fclose(traceFile);
+      traceFile = NULL;
+    }
+  }
+  leaveCriticalSection(&traceLock);
+}
@@ -107,8 +107,8 @@ getCharacterByAlias (wchar_t *character, const char *alias) {
 #endif /* HAVE_ICU */
 }
 
-int
-getCharacterWidth (wchar_t character) {
+static int
+computeCharacterWidth (wchar_t character) {
 #if defined(HAVE_WCWIDTH)
   return wcwidth(character);
 #elif defined(HAVE_ICU)
@@ -161,6 +161,64 @@ getCharacterWidth (wchar_t character) {
 #endif /* character width */
 }
 
+#ifdef __ATOMIC_ACQ_REL
+#define CHARACTER_WIDTH_CACHE
+
+/* The width of each character of a row (256 characters) is computed the first
+ * time one of them is asked for, and is then kept in two bits (-1 is 3).
+ */
+
+#define CHARACTER_WIDTH_ROW_COUNT (0X110000 >> UNICODE_ROW_SHIFT)
+#define CHARACTER_WIDTH_CHARACTER_COUNT (CHARACTER_WIDTH_ROW_COUNT << UNICODE_ROW_SHIFT)
+
+typedef uint8_t CharacterWidthRow[UNICODE_CELLS_PER_ROW / 4];
+static CharacterWidthRow *characterWidthRows[CHARACTER_WIDTH_ROW_COUNT];
+
+static CharacterWidthRow *
+makeCharacterWidthRow (CharacterWidthRow **row, wchar_t first) {
+  CharacterWidthRow *widths;
+
+  if ((widths = malloc(sizeof(*widths)))) {
+    CharacterWidthRow *old = NULL;
+
+    memset(widths, 0, sizeof(*widths));
+
+    for (unsigned int cell=0; cell<UNICODE_CELLS_PER_ROW; cell+=1) {
+      int width = computeCharacterWidth(first | cell);
+      (*widths)[cell >> 2] |= (width & 3) << ((cell & 3) << 1);
+    }
+
+    /* another thread may have made it at the same time */
+    if (!__atomic_compare_exchange_n(row, &old, widths, 0,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      free(widths);
+      widths = old;
+    }
+  }
+
+  return widths;
+}
+#endif /* __ATOMIC_ACQ_REL */
+
+int
+getCharacterWidth (wchar_t character) {
+#ifdef CHARACTER_WIDTH_CACHE
+  if ((character >= 0) && (character < CHARACTER_WIDTH_CHARACTER_COUNT)) {
+    CharacterWidthRow **row = &characterWidthRows[character >> UNICODE_ROW_SHIFT];
+    CharacterWidthRow *widths = __atomic_load_n(row, __ATOMIC_ACQUIRE);
+
+    if (widths || (widths = makeCharacterWidthRow(row, character & ~UNICODE_CELL_MASK))) {
+      static const signed char decode[] = {0, 1, 2, -1};
+      unsigned int cell = character & UNICODE_CELL_MASK;
+
+      return decode[((*widths)[cell >> 2] >> ((cell & 3) << 1)) & 3];
+    }
+  }
+#endif /* CHARACTER_WIDTH_CACHE */
+
+  return computeCharacterWidth(character);
+}
+
 int
 isBrailleCharacter (wchar_t character) {
   return (character & ~UNICODE_CELL_MASK) == UNICODE_BRAILLE_ROW;
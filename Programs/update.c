@@ -23,6 +23,7 @@
 
 #include "parameters.h"
 #include "log.h"
+#include "trace.h"
 #include "alert.h"
 #include "report.h"
 #include "strfmt.h"
@@ -37,6 +38,8 @@
 #include "spk.h"
 #include "scr.h"
 #include "scr_special.h"
+#include "scr_history.h"
+#include "scr_index.h"
 #include "scr_utils.h"
 #include "prefs.h"
 #include "status.h"
@@ -458,12 +461,69 @@ checkScreenScroll (int track) {
 #ifdef ENABLE_SPEECH_SUPPORT
 static int wasAutospeaking;
 
+/* Returns the length of the longest suffix of the text which is also a
+ * prefix of the pattern (both of the same length). Characters inserted
+ * (or deleted) at the start of a span shift the rest of it, so this finds
+ * the smallest such shift in linear time (Knuth-Morris-Pratt).
+ */
+static int
+getTextOverlap (const ScreenCharacter *text, const ScreenCharacter *pattern, int length) {
+  if (length < 1) return 0;
+
+  int borders[length];
+  int matched = 0;
+  borders[0] = 0;
+
+  for (int index=1; index<length; index+=1) {
+    wchar_t character = pattern[index].text;
+
+    while (matched && (character != pattern[matched].text)) matched = borders[matched-1];
+    if (character == pattern[matched].text) matched += 1;
+    borders[index] = matched;
+  }
+
+  matched = 0;
+
+  for (int index=0; index<length; index+=1) {
+    wchar_t character = text[index].text;
+
+    if (matched == length) matched = borders[matched-1];
+    while (matched && (character != pattern[matched].text)) matched = borders[matched-1];
+    if (character == pattern[matched].text) matched += 1;
+  }
+
+  return matched;
+}
+
+static int
+getTrimmedLength (const ScreenCharacter *characters, int length, int minimum) {
+  while (length > minimum) {
+    if (!iswspace(characters[length-1].text)) break;
+    length -= 1;
+  }
+
+  return length;
+}
+
+/* How far (up and down) a wrapped line is followed from the window's row. */
+#define AUTOSPEAK_WRAP_ROWS 4
+
+/* A row is assumed to wrap onto the next one if its last column isn't a space
+ * either before or after the change.
+ */
+static int
+isWrappedRow (const ScreenCharacter *oldRow, const ScreenCharacter *newRow, int width) {
+  return !iswspace(oldRow[width-1].text) || !iswspace(newRow[width-1].text);
+}
+
 void
 autospeak (AutospeakMode mode) {
   static int oldScreen = -1;
   static int oldX = -1;
   static int oldY = -1;
   static int oldWidth = 0;
+  static int oldTop = 0;
+  static int oldRows = 0;
   static ScreenCharacter *oldCharacters = NULL;
   static size_t oldSize = 0;
   static int cursorAssumedStable = 0;
@@ -472,12 +532,18 @@ autospeak (AutospeakMode mode) {
   int newX = scr.posx;
   int newY = scr.posy;
   int newWidth = scr.cols;
-  ScreenCharacter newCharacters[newWidth];
 
-  readScreenRow(ses->winy, newWidth, newCharacters);
+  /* the rows around the window's row, in case it's part of a wrapped line */
+  int newTop = MAX(ses->winy-AUTOSPEAK_WRAP_ROWS, 0);
+  int newRows = MAX(MIN(ses->winy+AUTOSPEAK_WRAP_ROWS+1, scr.rows), ses->winy+1) - newTop;
+  size_t newCount = newRows * newWidth;
+  ScreenCharacter newCharacters[newCount];
+  const ScreenCharacter *newRow = &newCharacters[(ses->winy - newTop) * newWidth];
+
+  readScreenRows(newTop, newWidth, newRows, newCharacters);
 
   if (!spk.track.isActive) {
-    const ScreenCharacter *characters = newCharacters;
+    const ScreenCharacter *characters = newRow;
     int column = 0;
     int count = newWidth;
     const char *reason = NULL;
@@ -488,80 +554,100 @@ autospeak (AutospeakMode mode) {
     } else if (!oldCharacters) {
       reason = "initial line";
       count = 0;
-    } else if ((newScreen != oldScreen) || (ses->winy != oldwiny) || (newWidth != oldWidth)) {
+    } else if ((newScreen != oldScreen) || (ses->winy != oldwiny) || (newWidth != oldWidth) ||
+               (newTop != oldTop) || (newRows != oldRows)) {
       if (!prefs.autospeakSelectedLine) count = 0;
       reason = "line selected";
       if (prefs.autospeakLineIndent) indent = 1;
     } else {
       int onScreen = (newX >= 0) && (newX < newWidth);
 
-      if (!isSameRow(newCharacters, oldCharacters, newWidth, isSameText)) {
-        if ((newY == ses->winy) && (newY == oldY) && onScreen) {
+      /* Changes are diffed over the window's row together with the rows
+       * which it wraps onto and from, so that editing a wrapped input line
+       * is handled as if it were on one long row.
+       */
+      int first = ses->winy - newTop;
+      int last = first;
+
+      while ((first > 0) &&
+             isWrappedRow(&oldCharacters[(first-1) * newWidth],
+                          &newCharacters[(first-1) * newWidth], newWidth)) {
+        first -= 1;
+      }
+
+      while ((last < (newRows - 1)) &&
+             isWrappedRow(&oldCharacters[last * newWidth],
+                          &newCharacters[last * newWidth], newWidth)) {
+        last += 1;
+      }
+
+      const ScreenCharacter *oldSpan = &oldCharacters[first * newWidth];
+      const ScreenCharacter *newSpan = &newCharacters[first * newWidth];
+      int spanWidth = (last - first + 1) * newWidth;
+      int spanTop = newTop + first;
+      int spanBottom = newTop + last;
+
+      if (!isSameRow(newSpan, oldSpan, spanWidth, isSameText)) {
+        characters = newSpan;
+
+        if ((newY >= spanTop) && (newY <= spanBottom) &&
+            (oldY >= spanTop) && (oldY <= spanBottom) && onScreen) {
+          /* the cursor's offsets within the span */
+          int newOffset = ((newY - spanTop) * newWidth) + newX;
+          int oldOffset = ((oldY - spanTop) * newWidth) + MIN(MAX(oldX, 0), newWidth-1);
+          int cursorMoved = (newX != oldX) || (newY != oldY);
+
           /* Sometimes the cursor moves after the screen content has been
            * updated. Make sure we don't race ahead of such a cursor move
            * before assuming that it is actually stable.
            */
-	  if ((newX == oldX) && !cursorAssumedStable) {
+	  if (!cursorMoved && !cursorAssumedStable) {
 	    scheduleUpdate("autospeak cursor stability check");
 	    cursorAssumedStable = 1;
 	    return;
 	  }
 
-          if ((newX == oldX) &&
-              isSameRow(newCharacters, oldCharacters, newX, isSameText)) {
-            int oldLength = oldWidth;
-            int newLength = newWidth;
-            int x = newX;
-
-            while (oldLength > oldX) {
-              if (!iswspace(oldCharacters[oldLength-1].text)) break;
-              oldLength -= 1;
-            }
-            if (oldLength < oldWidth) oldLength += 1;
-
-            while (newLength > newX) {
-              if (!iswspace(newCharacters[newLength-1].text)) break;
-              newLength -= 1;
-            }
-            if (newLength < newWidth) newLength += 1;
-
-            while (1) {
-              int done = 1;
-
-              if (x < newLength) {
-                if (isSameRow(newCharacters+x, oldCharacters+oldX, newWidth-x, isSameText)) {
-                  column = newX;
-                  count = prefs.autospeakInsertedCharacters? (x - newX): 0;
-                  reason = "characters inserted after cursor";
-                  goto autospeak;
-                }
-
-                done = 0;
+          if (!cursorMoved &&
+              isSameRow(newSpan, oldSpan, newOffset, isSameText)) {
+            int oldLength = getTrimmedLength(oldSpan, spanWidth, oldOffset);
+            int newLength = getTrimmedLength(newSpan, spanWidth, newOffset);
+
+            if (oldLength < spanWidth) oldLength += 1;
+            if (newLength < spanWidth) newLength += 1;
+
+            /* Only a pure insertion or deletion at the cursor is found here.
+             * Anything else falls through to the replace-span diff below.
+             */
+            {
+              int length = spanWidth - newOffset;
+              int inserted = length - getTextOverlap(newSpan+newOffset, oldSpan+oldOffset, length);
+              int deleted = length - getTextOverlap(oldSpan+oldOffset, newSpan+newOffset, length);
+
+              if ((newOffset + inserted) >= newLength) inserted = 0;
+              if ((oldOffset + deleted) >= oldLength) deleted = 0;
+
+              if (inserted && (!deleted || (inserted <= deleted))) {
+                column = newOffset;
+                count = prefs.autospeakInsertedCharacters? inserted: 0;
+                reason = "characters inserted after cursor";
+                goto autospeak;
               }
 
-              if (x < oldLength) {
-                if (isSameRow(newCharacters+newX, oldCharacters+x, oldWidth-x, isSameText)) {
-                  characters = oldCharacters;
-                  column = oldX;
-                  count = prefs.autospeakDeletedCharacters? (x - oldX): 0;
-                  reason = "characters deleted after cursor";
-                  goto autospeak;
-                }
-
-                done = 0;
+              if (deleted) {
+                characters = oldSpan;
+                column = oldOffset;
+                count = prefs.autospeakDeletedCharacters? deleted: 0;
+                reason = "characters deleted after cursor";
+                goto autospeak;
               }
-
-              if (done) break;
-              x += 1;
             }
           }
 
-          if (oldX < 0) oldX = 0;
-          if ((newX > oldX) &&
-              isSameRow(newCharacters, oldCharacters, oldX, isSameText) &&
-              isSameRow(newCharacters+newX, oldCharacters+oldX, newWidth-newX, isSameText)) {
-            column = oldX;
-            count = newX - oldX;
+          if ((newOffset > oldOffset) &&
+              isSameRow(newSpan, oldSpan, oldOffset, isSameText) &&
+              isSameRow(newSpan+newOffset, oldSpan+oldOffset, spanWidth-newOffset, isSameText)) {
+            column = oldOffset;
+            count = newOffset - oldOffset;
 
             if (prefs.autospeakCompletedWords) {
               int last = column + count - 1;
@@ -597,23 +683,56 @@ autospeak (AutospeakMode mode) {
             goto autospeak;
           }
 
-          if (oldX >= oldWidth) oldX = oldWidth - 1;
-          if ((newX < oldX) &&
-              isSameRow(newCharacters, oldCharacters, newX, isSameText) &&
-              isSameRow(newCharacters+newX, oldCharacters+oldX, oldWidth-oldX, isSameText)) {
-            characters = oldCharacters;
-            column = newX;
-            count = prefs.autospeakDeletedCharacters? (oldX - newX): 0;
+          if ((newOffset < oldOffset) &&
+              isSameRow(newSpan, oldSpan, newOffset, isSameText) &&
+              isSameRow(newSpan+newOffset, oldSpan+oldOffset, spanWidth-oldOffset, isSameText)) {
+            characters = oldSpan;
+            column = newOffset;
+            count = prefs.autospeakDeletedCharacters? (oldOffset - newOffset): 0;
             reason = "characters deleted before cursor";
             goto autospeak;
           }
         }
 
-        while (newCharacters[column].text == oldCharacters[column].text) ++column;
-        while (newCharacters[count-1].text == oldCharacters[count-1].text) --count;
-        count -= column;
-        if (!prefs.autospeakReplacedCharacters) count = 0;
-        reason = "characters replaced";
+        /* Replace-span diff: the span which differs is what's left after
+         * trimming the common prefix and then the common suffix (trailing
+         * spaces aside). Whichever of its old and new parts is empty makes
+         * it an insertion or a deletion rather than a replacement.
+         */
+        {
+          int oldLength = getTrimmedLength(oldSpan, spanWidth, 0);
+          int newLength = getTrimmedLength(newSpan, spanWidth, 0);
+          int shortest = MIN(oldLength, newLength);
+          int prefix = 0;
+          int suffix = 0;
+
+          while ((prefix < shortest) && (newSpan[prefix].text == oldSpan[prefix].text)) prefix += 1;
+          shortest -= prefix;
+
+          while ((suffix < shortest) &&
+                 (newSpan[newLength-suffix-1].text == oldSpan[oldLength-suffix-1].text)) {
+            suffix += 1;
+          }
+
+          {
+            int inserted = newLength - prefix - suffix;
+            int deleted = oldLength - prefix - suffix;
+
+            column = prefix;
+
+            if (!deleted) {
+              count = prefs.autospeakInsertedCharacters? inserted: 0;
+              reason = "characters inserted";
+            } else if (!inserted) {
+              characters = oldSpan;
+              count = prefs.autospeakDeletedCharacters? deleted: 0;
+              reason = "characters deleted";
+            } else {
+              count = prefs.autospeakReplacedCharacters? inserted: 0;
+              reason = "characters replaced";
+            }
+          }
+        }
       } else if ((newY == ses->winy) && ((newX != oldX) || (newY != oldY)) && onScreen) {
         column = newX;
         count = prefs.autospeakSelectedCharacter? 1: 0;
@@ -676,11 +795,13 @@ autospeak (AutospeakMode mode) {
     }
   }
 
-  if (saveScreenCharacters(&oldCharacters, &oldSize, newCharacters, newWidth)) {
+  if (saveScreenCharacters(&oldCharacters, &oldSize, newCharacters, newCount)) {
     oldScreen = newScreen;
     oldX = newX;
     oldY = newY;
     oldWidth = newWidth;
+    oldTop = newTop;
+    oldRows = newRows;
     cursorAssumedStable = 0;
   }
 }
@@ -831,10 +952,22 @@ translateBrailleWindow (
 static void
 doUpdate (void) {
   logMessage(LOG_CATEGORY(UPDATE_EVENTS), "starting");
+  TRACE_EVENT(UPDATE_BEGIN, 0);
+
   unrequireAllBlinkDescriptors();
   refreshScreen();
+  invalidateScreenRowIndex();
+
+  if (prefs.screenHistory) {
+    if (isMainScreen()) addScreenHistory(&mainScreen.base);
+  } else {
+    clearScreenHistory();
+  }
+
   updateSessionAttributes();
+  beginScreenSnapshot(&scr);
   api.flushOutput();
+  TRACE_EVENT(UPDATE_SCREEN, scr.number, scr.cols, scr.rows, scr.posx, scr.posy);
 
   if (scr.unreadable) {
     logMessage(LOG_CATEGORY(UPDATE_EVENTS), "screen unreadable: %s", scr.unreadable);
@@ -899,6 +1032,7 @@ doUpdate (void) {
                      scr.number,
                      ses->trkx, ses->trky, scr.posx, scr.posy,
                      oldx, oldy, ses->winx, ses->winy);
+          TRACE_EVENT(CURSOR_TRACK, scr.number, scr.posx, scr.posy, ses->winx, ses->winy);
 
           ses->spkx = ses->trkx = scr.posx;
           ses->spky = ses->trky = scr.posy;
@@ -1129,7 +1263,9 @@ doUpdate (void) {
     api.releaseDriver();
   }
 
+  endScreenSnapshot();
   resetAllBlinkDescriptors();
+  TRACE_EVENT(UPDATE_END, 0);
   logMessage(LOG_CATEGORY(UPDATE_EVENTS), "finished");
 }
 